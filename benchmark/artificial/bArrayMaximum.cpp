@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/maxSparse.hpp"
+#include "atlantis/propagation/invariants/maxTournament.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output = max(x[0], ..., x[n - 1]), as for a makespan objective, where
+ * x[0] holds the unique maximum. Compares MaxSparse (argument 0) with
+ * MaxTournament (argument 1).
+ */
+class ArrayMaximum : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  propagation::VarViewId output{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> indexDist;
+  std::uniform_int_distribution<Int> valueDist;
+
+  size_t arity{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    arity = static_cast<size_t>(state.range(0));
+    const bool isTournament = state.range(1) != 0;
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    gen = std::mt19937(rd());
+    const Int ub = static_cast<Int>(arity);
+    valueDist = std::uniform_int_distribution<Int>(0, ub - 1);
+    indexDist = std::uniform_int_distribution<size_t>(1, arity - 1);
+
+    inputs.reserve(arity);
+    inputs.emplace_back(solver->makeIntVar(ub, 0, ub));
+    for (size_t i = 1; i < arity; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, ub));
+    }
+    output = solver->makeIntVar(0, 0, ub);
+    if (isTournament) {
+      solver->makeInvariant<propagation::MaxTournament>(
+          *solver, output, std::vector<propagation::VarViewId>(inputs));
+    } else {
+      solver->makeInvariant<propagation::MaxSparse>(
+          *solver, output, std::vector<propagation::VarViewId>(inputs));
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    solver = nullptr;
+  }
+};
+
+// Changes a random input that does not hold the maximum:
+BENCHMARK_DEFINE_F(ArrayMaximum, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[indexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+// Decreases the input that holds the maximum:
+BENCHMARK_DEFINE_F(ArrayMaximum, probe_decrease_max)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs.front(), valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+// Arguments: {arity, invariant (0: MaxSparse, 1: MaxTournament)}
+static void arrayMaximumArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int arity = 8; arity <= 100000; arity *= 4) {
+    for (int invariant = 0; invariant <= 1; ++invariant) {
+      benchmark->Args({arity, invariant});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+  // Building a MaxSparse takes quadratic time, so only MaxTournament is
+  // run for the largest arity:
+  benchmark->Args({100000, 1});
+}
+
+BENCHMARK_REGISTER_F(ArrayMaximum, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(arrayMaximumArguments);
+
+BENCHMARK_REGISTER_F(ArrayMaximum, probe_decrease_max)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(arrayMaximumArguments);
+
+}  // namespace atlantis::benchmark
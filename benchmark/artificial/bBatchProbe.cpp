@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+#include "atlantis/search/assignment.hpp"
+#include "atlantis/search/move.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * Probes per second of a scan over k values of a random variable, where the
+ * k candidates are either probed one by one or as one batch.
+ *
+ * The model is all_different([x_1 + x_2, x_2 + x_3, ..., x_{n-1} + x_n]).
+ */
+class BatchProbe : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::unique_ptr<search::Assignment> assignment;
+  std::vector<propagation::VarViewId> decisionVars;
+  propagation::VarViewId violation{propagation::NULL_ID};
+  propagation::VarViewId objective{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> decisionVarIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+
+  size_t numDecisionVars{256};
+  size_t numCandidates{0};
+  bool batched{false};
+
+  void SetUp(const ::benchmark::State& state) override {
+    numCandidates = static_cast<size_t>(state.range(0));
+    batched = state.range(1) != 0;
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    decisionVars.reserve(numDecisionVars);
+    for (size_t i = 0; i < numDecisionVars; ++i) {
+      decisionVars.emplace_back(
+          solver->makeIntVar(static_cast<Int>(i), 0,
+                             static_cast<Int>(numDecisionVars) - 1));
+    }
+
+    std::vector<propagation::VarViewId> sums;
+    sums.reserve(numDecisionVars - 1);
+    for (size_t i = 0; i + 1 < numDecisionVars; ++i) {
+      sums.emplace_back(solver->makeIntVar(
+          0, 0, 2 * (static_cast<Int>(numDecisionVars) - 1)));
+      solver->makeInvariant<propagation::Linear>(
+          *solver, sums.back(),
+          std::vector<propagation::VarViewId>{decisionVars[i],
+                                              decisionVars[i + 1]});
+    }
+
+    violation = solver->makeIntVar(0, 0, static_cast<Int>(numDecisionVars));
+    solver->makeViolationInvariant<propagation::AllDifferent>(
+        *solver, violation, std::move(sums));
+    objective = solver->makeIntVar(0, 0, 0);
+
+    solver->close();
+
+    assignment = std::make_unique<search::Assignment>(
+        *solver, violation, objective, propagation::ObjectiveDirection::NONE,
+        0);
+
+    gen = std::mt19937(rd());
+    decisionVarIndexDist =
+        std::uniform_int_distribution<size_t>(0, numDecisionVars - 1);
+    valueDist = std::uniform_int_distribution<Int>(
+        0, static_cast<Int>(numDecisionVars) - 1);
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    assignment = nullptr;
+    decisionVars.clear();
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(BatchProbe, scan)(::benchmark::State& st) {
+  size_t probes = 0;
+  std::vector<search::Move<1>> moves;
+  moves.reserve(numCandidates);
+  for ([[maybe_unused]] const auto& _ : st) {
+    const propagation::VarViewId x = decisionVars[decisionVarIndexDist(gen)];
+    const Int offset = valueDist(gen);
+    moves.clear();
+    for (size_t i = 0; i < numCandidates; ++i) {
+      moves.emplace_back(
+          std::array<propagation::VarViewId, 1>{x},
+          std::array<Int, 1>{(offset + static_cast<Int>(i)) %
+                             static_cast<Int>(numDecisionVars)});
+    }
+    if (batched) {
+      ::benchmark::DoNotOptimize(
+          assignment->probe(std::span<search::Move<1>>(moves)));
+    } else {
+      for (search::Move<1>& move : moves) {
+        ::benchmark::DoNotOptimize(move.probe(*assignment));
+      }
+    }
+    probes += numCandidates;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+static void batchArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int numCandidates = 1; numCandidates <= 256; numCandidates *= 2) {
+    for (int batched = 0; batched <= 1; ++batched) {
+      for (int mode : {0, 3}) {
+        benchmark->Args({numCandidates, batched, mode});
+      }
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(BatchProbe, scan)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(batchArguments);
+
+}  // namespace atlantis::benchmark
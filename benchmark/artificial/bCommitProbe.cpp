@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+#include "atlantis/search/assignment.hpp"
+#include "atlantis/search/move.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * Moves per second of a swap neighbourhood for a given ratio of accepted
+ * moves, where accepted moves are either committed in place (the probe is
+ * committed) or propagated again (the move is assigned).
+ *
+ * The model is all_different([x_1 + x_2, x_2 + x_3, ..., x_{n-1} + x_n]).
+ */
+class CommitProbe : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::unique_ptr<search::Assignment> assignment;
+  std::vector<propagation::VarViewId> decisionVars;
+  propagation::VarViewId violation{propagation::NULL_ID};
+  propagation::VarViewId objective{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> decisionVarIndexDist;
+  std::uniform_int_distribution<Int> acceptDist{0, 99};
+
+  size_t numDecisionVars{0};
+  Int acceptancePercent{0};
+  bool commitInPlace{false};
+
+  void SetUp(const ::benchmark::State& state) override {
+    numDecisionVars = static_cast<size_t>(state.range(0));
+    acceptancePercent = state.range(1);
+    commitInPlace = state.range(2) != 0;
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+
+    decisionVars.reserve(numDecisionVars);
+    for (size_t i = 0; i < numDecisionVars; ++i) {
+      decisionVars.emplace_back(
+          solver->makeIntVar(static_cast<Int>(i), 0,
+                             static_cast<Int>(numDecisionVars) - 1));
+    }
+
+    std::vector<propagation::VarViewId> sums;
+    sums.reserve(numDecisionVars - 1);
+    for (size_t i = 0; i + 1 < numDecisionVars; ++i) {
+      sums.emplace_back(solver->makeIntVar(
+          0, 0, 2 * (static_cast<Int>(numDecisionVars) - 1)));
+      solver->makeInvariant<propagation::Linear>(
+          *solver, sums.back(),
+          std::vector<propagation::VarViewId>{decisionVars[i],
+                                              decisionVars[i + 1]});
+    }
+
+    violation =
+        solver->makeIntVar(0, 0, static_cast<Int>(numDecisionVars));
+    solver->makeViolationInvariant<propagation::AllDifferent>(
+        *solver, violation, std::move(sums));
+    objective = solver->makeIntVar(0, 0, 0);
+
+    solver->close();
+
+    assignment = std::make_unique<search::Assignment>(
+        *solver, violation, objective, propagation::ObjectiveDirection::NONE,
+        0);
+
+    gen = std::mt19937(rd());
+    decisionVarIndexDist =
+        std::uniform_int_distribution<size_t>(0, numDecisionVars - 1);
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    assignment = nullptr;
+    decisionVars.clear();
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(CommitProbe, swap)(::benchmark::State& st) {
+  size_t moves = 0;
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const propagation::VarViewId x = decisionVars[decisionVarIndexDist(gen)];
+    const propagation::VarViewId y = decisionVars[decisionVarIndexDist(gen)];
+    search::Move<2> move({x, y}, {assignment->value(y), assignment->value(x)});
+    ::benchmark::DoNotOptimize(move.probe(*assignment));
+    ++moves;
+
+    if (acceptDist(gen) < acceptancePercent) {
+      if (commitInPlace) {
+        move.commit(*assignment);
+      } else {
+        assignment->assign([&](auto& modifier) {
+          modifier.set(x, solver->committedValue(y));
+          modifier.set(y, solver->committedValue(x));
+        });
+      }
+      ++commits;
+    }
+  }
+  st.counters["moves_per_second"] = ::benchmark::Counter(
+      static_cast<double>(moves), ::benchmark::Counter::kIsRate);
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+static void acceptanceArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int numDecisionVars : {64, 1024}) {
+    for (int acceptancePercent : {0, 10, 30, 60, 100}) {
+      for (int commitInPlace = 0; commitInPlace <= 1; ++commitInPlace) {
+        benchmark->Args({numDecisionVars, acceptancePercent, commitInPlace});
+      }
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(CommitProbe, swap)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(acceptanceArguments);
+
+}  // namespace atlantis::benchmark
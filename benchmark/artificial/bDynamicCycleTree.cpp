@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/elementVar.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A layer with dynamic cycles where moves only change a single dynamic
+ * input, and where the topological order of the layer therefore only
+ * changes locally:
+ *
+ *   x[k] = element(i[k], [base, x[0] + c, x[1] + c, ..., x[n - 1] + c])
+ *
+ * The indices form a random recursive tree over a fixed permutation of the
+ * variables, where each variable either refers to base or to a variable
+ * that precedes it in the permutation. A move makes a random variable refer
+ * to base or to one of its predecessors.
+ *
+ * When c = 0, all variables have the same value and a move only changes the
+ * topological order; when c = 1, a move also changes the values of the
+ * subtree of the moved variable.
+ */
+class DynamicCycleTree : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> indices;
+  std::vector<size_t> permutation;
+  propagation::VarViewId output{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  size_t n{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    n = static_cast<size_t>(state.range(0));
+    const Int offset = state.range(1);
+
+    gen = std::mt19937(rd());
+    permutation.resize(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), gen);
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    const propagation::VarViewId base = solver->makeIntVar(0, 0, 0);
+    std::vector<propagation::VarViewId> x;
+    x.reserve(n);
+    indices.assign(n, propagation::NULL_ID);
+    for (size_t k = 0; k < n; ++k) {
+      x.emplace_back(solver->makeIntVar(0, 0, static_cast<Int>(n)));
+    }
+    for (size_t r = 0; r < n; ++r) {
+      indices[permutation[r]] =
+          solver->makeIntVar(randomIndex(r), 1, static_cast<Int>(n) + 1);
+    }
+    std::vector<propagation::VarViewId> array{base};
+    array.reserve(n + 1);
+    for (size_t k = 0; k < n; ++k) {
+      array.emplace_back(offset == 0
+                             ? x[k]
+                             : solver->makeIntView<propagation::IntOffsetView>(
+                                   *solver, x[k], offset));
+    }
+    for (size_t k = 0; k < n; ++k) {
+      solver->makeInvariant<propagation::ElementVar>(
+          *solver, x[k], indices[k], std::vector<propagation::VarViewId>(array));
+    }
+    output = solver->makeIntVar(0, 0, static_cast<Int>(n * n));
+    solver->makeInvariant<propagation::Linear>(*solver, output, std::move(x));
+
+    solver->close();
+  }
+
+  // A random index for the variable at rank r in the permutation:
+  Int randomIndex(size_t r) {
+    std::uniform_int_distribution<size_t> predDist(0, r);
+    const size_t pred = predDist(gen);
+    return pred == r ? 1 : static_cast<Int>(permutation[pred]) + 2;
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    indices.clear();
+    permutation.clear();
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(DynamicCycleTree, probe_single)(::benchmark::State& st) {
+  std::uniform_int_distribution<size_t> rankDist(0, n - 1);
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t r = rankDist(gen);
+    solver->beginMove();
+    solver->setValue(indices[permutation[r]], randomIndex(r));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(DynamicCycleTree, commit_single)(::benchmark::State& st) {
+  std::uniform_int_distribution<size_t> rankDist(0, n - 1);
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t r = rankDist(gen);
+    solver->beginMove();
+    solver->setValue(indices[permutation[r]], randomIndex(r));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(output);
+    solver->endCommit();
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+static void dynamicCycleTreeArguments(
+    ::benchmark::internal::Benchmark* benchmark) {
+  for (int n : {16, 64, 256, 1024}) {
+    for (int offset = 0; offset <= 1; ++offset) {
+      benchmark->Args({n, offset, 0});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(DynamicCycleTree, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(dynamicCycleTreeArguments);
+
+BENCHMARK_REGISTER_F(DynamicCycleTree, commit_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(dynamicCycleTreeArguments);
+
+}  // namespace atlantis::benchmark
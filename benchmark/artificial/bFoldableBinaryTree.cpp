@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -62,6 +63,18 @@ class FoldableBinaryTree : public ::benchmark::Fixture {
   Int lb{-2};
   Int ub{2};
 
+  // The time it took to close the solver:
+  double closeSeconds{0};
+
+  // Reports the close time and the memory that the output-to-input marking
+  // occupies:
+  void reportClose(::benchmark::State& st) const {
+    st.counters["close_seconds"] = closeSeconds;
+    st.counters["marking_bytes"] = ::benchmark::Counter(
+        static_cast<double>(solver->outputToInputMarkingMemoryUsage()),
+        ::benchmark::Counter::kDefaults, ::benchmark::Counter::kIs1024);
+  }
+
   void probe(::benchmark::State& st, size_t moveCount);
   void probeRnd(::benchmark::State& st, size_t moveCount);
   void commit(::benchmark::State& st, size_t moveCount);
@@ -77,7 +90,11 @@ class FoldableBinaryTree : public ::benchmark::Fixture {
 
     queryVar = createTree();
 
+    const auto closeStart = std::chrono::steady_clock::now();
     solver->close();
+    closeSeconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - closeStart)
+                       .count();
 
     genValue = std::mt19937(rd());
     decisionVarValueDist = std::uniform_int_distribution<Int>(lb, ub);
@@ -112,6 +129,7 @@ void FoldableBinaryTree::probe(::benchmark::State& st, size_t moveCount) {
 
   st.counters["probes_per_second"] = ::benchmark::Counter(
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  reportClose(st);
 }
 
 void FoldableBinaryTree::probeRnd(::benchmark::State& st, size_t moveCount) {
@@ -137,6 +155,7 @@ void FoldableBinaryTree::probeRnd(::benchmark::State& st, size_t moveCount) {
 
   st.counters["probes_per_second"] = ::benchmark::Counter(
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  reportClose(st);
 }
 
 void FoldableBinaryTree::commit(::benchmark::State& st, size_t moveCount) {
@@ -229,6 +248,25 @@ BENCHMARK_DEFINE_F(FoldableBinaryTree, commit_move_all)
 BENCHMARK_DEFINE_F(FoldableBinaryTree, commit_move_all_query_rnd)
 (::benchmark::State& st) { commitRnd(std::ref(st), decisionVars.size()); }
 
+BENCHMARK_DEFINE_F(FoldableBinaryTree, probe_single_static_marking)
+(::benchmark::State& st) { probe(std::ref(st), 1); }
+
+// Deep trees in output-to-input static marking mode, for measuring the time
+// and memory it takes to compute the search variable ancestors:
+static void staticMarkingTreeArguments(
+    ::benchmark::internal::Benchmark* benchmark) {
+  for (int treeHeight = 16; treeHeight <= 1024; treeHeight *= 4) {
+    benchmark->Args({treeHeight, 2});
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(FoldableBinaryTree, probe_single_static_marking)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(staticMarkingTreeArguments);
+
 /*
 
 // -----------------------------------------
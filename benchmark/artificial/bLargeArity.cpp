@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/maxSparse.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A single invariant over a large number of search variables, where each
+ * move changes a single input. The cost of committing such a move should
+ * not depend on the arity of the invariant.
+ */
+class LargeArity : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  propagation::VarViewId output{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> indexDist;
+  std::uniform_int_distribution<Int> valueDist;
+
+  size_t arity{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    arity = static_cast<size_t>(state.range(0));
+    const bool isMax = state.range(1) == 0;
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    gen = std::mt19937(rd());
+    const Int ub = static_cast<Int>(arity) - 1;
+    valueDist = std::uniform_int_distribution<Int>(0, ub);
+    indexDist = std::uniform_int_distribution<size_t>(0, arity - 1);
+
+    inputs.reserve(arity);
+    for (size_t i = 0; i < arity; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, ub));
+    }
+    output = solver->makeIntVar(0, 0, static_cast<Int>(arity));
+    if (isMax) {
+      solver->makeInvariant<propagation::MaxSparse>(
+          *solver, output, std::vector<propagation::VarViewId>(inputs));
+    } else {
+      solver->makeViolationInvariant<propagation::AllDifferent>(
+          *solver, output, std::vector<propagation::VarViewId>(inputs));
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(LargeArity, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[indexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(LargeArity, commit_single)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[indexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(output);
+    solver->endCommit();
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+// Arguments: {arity, invariant (0: MaxSparse, 1: AllDifferent), mode}
+static void largeArityArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int arity = 1000; arity <= 10000; arity *= 10) {
+    for (int invariant = 0; invariant <= 1; ++invariant) {
+      benchmark->Args({arity, invariant, 0});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(LargeArity, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(largeArityArguments);
+
+BENCHMARK_REGISTER_F(LargeArity, commit_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(largeArityArguments);
+
+}  // namespace atlantis::benchmark
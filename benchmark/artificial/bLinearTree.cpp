@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <random>
 #include <stack>
@@ -85,6 +86,18 @@ class LinearTree : public ::benchmark::Fixture {
   Int lb{-1000};
   Int ub{1000};
 
+  // The time it took to close the solver:
+  double closeSeconds{0};
+
+  // Reports the close time and the memory that the output-to-input marking
+  // occupies:
+  void reportClose(::benchmark::State& st) const {
+    st.counters["close_seconds"] = closeSeconds;
+    st.counters["marking_bytes"] = ::benchmark::Counter(
+        static_cast<double>(solver->outputToInputMarkingMemoryUsage()),
+        ::benchmark::Counter::kDefaults, ::benchmark::Counter::kIs1024);
+  }
+
   void probe(::benchmark::State& st, size_t numMoves);
   void probeRnd(::benchmark::State& st, size_t numMoves);
   void commit(::benchmark::State& st, size_t numMoves);
@@ -101,7 +114,11 @@ class LinearTree : public ::benchmark::Fixture {
 
     createTree();
 
+    const auto closeStart = std::chrono::steady_clock::now();
     solver->close();
+    closeSeconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - closeStart)
+                       .count();
 
     gen = std::mt19937(rd());
     decisionVarIndexDist =
@@ -134,6 +151,7 @@ void LinearTree::probe(::benchmark::State& st, size_t numMoves) {
 
   st.counters["probes_per_second"] = ::benchmark::Counter(
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  reportClose(st);
 }
 
 void LinearTree::probeRnd(::benchmark::State& st, size_t numMoves) {
@@ -155,6 +173,7 @@ void LinearTree::probeRnd(::benchmark::State& st, size_t numMoves) {
 
   st.counters["probes_per_second"] = ::benchmark::Counter(
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  reportClose(st);
 }
 
 void LinearTree::commit(::benchmark::State& st, size_t numMoves) {
@@ -238,6 +257,25 @@ BENCHMARK_DEFINE_F(LinearTree, commit_all_query_rnd)
 BENCHMARK_DEFINE_F(LinearTree, probe_all_query_rnd)
 (::benchmark::State& st) { probeRnd(std::ref(st), decisionVars.size()); }
 
+BENCHMARK_DEFINE_F(LinearTree, probe_single_static_marking)
+(::benchmark::State& st) { probe(std::ref(st), 1); }
+
+// Tall binary trees in output-to-input static marking mode, for measuring
+// the time and memory it takes to compute the search variable ancestors:
+static void staticMarkingTreeArguments(
+    ::benchmark::internal::Benchmark* benchmark) {
+  for (int treeHeight = 6; treeHeight <= 14; treeHeight += 4) {
+    benchmark->Args({treeHeight, 2, 2});
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(LinearTree, probe_single_static_marking)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(staticMarkingTreeArguments);
+
 /*
 
 // -----------------------------------------
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * Measures the time it takes to construct (and destroy) a model consisting
+ * of numInvariants independent linear invariants x + (y + 1), where y + 1 is
+ * an offset view.
+ *
+ * When useHint is 1, the solver is told the size of the model before it is
+ * constructed, as is done by the invariant graph.
+ */
+class ModelConstruction : public ::benchmark::Fixture {
+ public:
+  size_t numInvariants{0};
+  bool useHint{false};
+
+  void SetUp(const ::benchmark::State& state) override {
+    numInvariants = static_cast<size_t>(state.range(0));
+    useHint = state.range(1) != 0;
+  }
+
+  void TearDown(const ::benchmark::State&) override {}
+
+  std::unique_ptr<propagation::Solver> build() const {
+    auto solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    if (useHint) {
+      solver->reserve(3 * numInvariants, numInvariants, numInvariants);
+    }
+    for (size_t i = 0; i < numInvariants; ++i) {
+      const propagation::VarViewId x = solver->makeIntVar(0, -10, 10);
+      const propagation::VarViewId y = solver->makeIntVar(0, -10, 10);
+      const propagation::VarViewId output = solver->makeIntVar(0, -20, 20);
+      solver->makeInvariant<propagation::Linear>(
+          *solver, output,
+          std::vector<propagation::VarViewId>{
+              x, solver->makeIntView<propagation::IntOffsetView>(*solver, y,
+                                                                 1)});
+    }
+    solver->close();
+    return solver;
+  }
+};
+
+BENCHMARK_DEFINE_F(ModelConstruction, build)(::benchmark::State& st) {
+  size_t numArenaBlocks = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    auto solver = build();
+    numArenaBlocks = solver->store().numArenaBlocks();
+    ::benchmark::DoNotOptimize(solver);
+  }
+  st.counters["invariants_per_second"] = ::benchmark::Counter(
+      static_cast<double>(numInvariants * st.iterations()),
+      ::benchmark::Counter::kIsRate);
+  st.counters["arena_blocks"] =
+      ::benchmark::Counter(static_cast<double>(numArenaBlocks));
+}
+
+static void constructionArguments(::benchmark::internal::Benchmark* b) {
+  for (int numInvariants = 1000; numInvariants <= 1000000;
+       numInvariants *= 10) {
+    for (int useHint = 0; useHint <= 1; ++useHint) {
+      b->Args({numInvariants, useHint});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(ModelConstruction, build)
+    ->Unit(::benchmark::kMillisecond)
+    ->Apply(constructionArguments);
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A model where each move has a constant-size propagation footprint
+ * regardless of the size of the model:
+ *
+ * - n search variables x_1, ..., x_n
+ * - n / 2 linear invariants y_i = x_{2i} + x_{2i + 1}
+ * - one linear invariant output = y_1 + ... + y_{n/2}
+ *
+ * Changing a single search variable x_j only changes x_j, y_{j/2}, and
+ * output, so the probe latency should be independent of n.
+ */
+class ProbeFootprint : public ::benchmark::Fixture {
+ public:
+  std::shared_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> decisionVars;
+  propagation::VarViewId output{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> decisionVarIndexDist;
+  std::uniform_int_distribution<Int> decisionVarValueDist;
+
+  size_t numDecisionVars{0};
+  Int lb{-1000};
+  Int ub{1000};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_shared<propagation::Solver>();
+    numDecisionVars = static_cast<size_t>(state.range(0));
+    numDecisionVars -= numDecisionVars % 2;
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    decisionVars.reserve(numDecisionVars);
+    for (size_t i = 0; i < numDecisionVars; ++i) {
+      decisionVars.emplace_back(solver->makeIntVar(0, lb, ub));
+    }
+
+    std::vector<propagation::VarViewId> sums;
+    sums.reserve(numDecisionVars / 2);
+    for (size_t i = 0; i < numDecisionVars; i += 2) {
+      sums.emplace_back(solver->makeIntVar(0, 2 * lb, 2 * ub));
+      solver->makeInvariant<propagation::Linear>(
+          *solver, sums.back(),
+          std::vector<propagation::VarViewId>{decisionVars[i],
+                                              decisionVars[i + 1]});
+    }
+
+    output = solver->makeIntVar(0, lb * static_cast<Int>(numDecisionVars),
+                                ub * static_cast<Int>(numDecisionVars));
+    solver->makeInvariant<propagation::Linear>(*solver, output,
+                                               std::move(sums));
+
+    solver->close();
+
+    gen = std::mt19937(rd());
+    decisionVarIndexDist =
+        std::uniform_int_distribution<size_t>(0, numDecisionVars - 1);
+    decisionVarValueDist = std::uniform_int_distribution<Int>(lb, ub);
+  }
+
+  void TearDown(const ::benchmark::State&) override { decisionVars.clear(); }
+};
+
+BENCHMARK_DEFINE_F(ProbeFootprint, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(decisionVars[decisionVarIndexDist(gen)],
+                     decisionVarValueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["solver_vars"] =
+      ::benchmark::Counter(static_cast<double>(solver->numVars()));
+}
+
+BENCHMARK_DEFINE_F(ProbeFootprint, probe_swap)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t i = decisionVarIndexDist(gen);
+    const size_t j = decisionVarIndexDist(gen);
+    solver->beginMove();
+    solver->setValue(decisionVars[i], solver->committedValue(decisionVars[j]));
+    solver->setValue(decisionVars[j], solver->committedValue(decisionVars[i]));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["solver_vars"] =
+      ::benchmark::Counter(static_cast<double>(solver->numVars()));
+}
+
+static void footprintArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (Int numDecisionVars = 1024; numDecisionVars <= (1 << 20);
+       numDecisionVars *= 4) {
+    // Output-to-input propagation (modes 1-3) always visits all inputs of the
+    // queried output, and therefore only input-to-output propagation and
+    // output-to-input with exploration marking (for comparison) are included:
+    for (Int mode : {0, 3}) {
+      benchmark->Args({numDecisionVars, mode});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(ProbeFootprint, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(footprintArguments);
+
+BENCHMARK_REGISTER_F(ProbeFootprint, probe_swap)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(footprintArguments);
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/boolLinear.hpp"
+#include "atlantis/propagation/invariants/countConst.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * Recomputes a single invariant over a large number of search variables,
+ * as is done for every invariant when the solver is closed. The invariant
+ * is a Linear (argument 0), a BoolLinear (argument 1), or a CountConst
+ * (argument 2).
+ */
+class Recompute : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  propagation::VarViewId output{propagation::NULL_ID};
+  propagation::Invariant* invariant{nullptr};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  size_t arity{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    arity = static_cast<size_t>(state.range(0));
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+
+    gen = std::mt19937(rd());
+    std::uniform_int_distribution<Int> valueDist(0, 3);
+    std::uniform_int_distribution<Int> coeffDist(-10, 10);
+
+    inputs.reserve(arity);
+    std::vector<Int> coeffs;
+    coeffs.reserve(arity);
+    for (size_t i = 0; i < arity; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, 3));
+      coeffs.emplace_back(coeffDist(gen));
+    }
+    const Int bound = 10 * 3 * static_cast<Int>(arity);
+    output = solver->makeIntVar(0, -bound, bound);
+    switch (state.range(1)) {
+      case 0:
+        invariant = &solver->makeInvariant<propagation::Linear>(
+            *solver, output, std::move(coeffs),
+            std::vector<propagation::VarViewId>(inputs));
+        break;
+      case 1:
+        invariant = &solver->makeInvariant<propagation::BoolLinear>(
+            *solver, output, std::move(coeffs),
+            std::vector<propagation::VarViewId>(inputs));
+        break;
+      default:
+        invariant = &solver->makeInvariant<propagation::CountConst>(
+            *solver, output, 0, std::vector<propagation::VarViewId>(inputs));
+        break;
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    invariant = nullptr;
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(Recompute, recompute)(::benchmark::State& st) {
+  size_t recomputedInputs = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    invariant->recompute(solver->currentTimestamp());
+    recomputedInputs += arity;
+  }
+  st.counters["inputs_per_second"] = ::benchmark::Counter(
+      static_cast<double>(recomputedInputs), ::benchmark::Counter::kIsRate);
+}
+
+// Arguments: {arity, invariant (0: Linear, 1: BoolLinear, 2: CountConst)}
+static void recomputeArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int arity = 16; arity <= 1048576; arity *= 16) {
+    for (int invariant = 0; invariant <= 2; ++invariant) {
+      benchmark->Args({arity, invariant});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(Recompute, recompute)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(recomputeArguments);
+
+}  // namespace atlantis::benchmark
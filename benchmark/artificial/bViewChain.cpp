@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+#include "atlantis/propagation/views/lessEqualConst.hpp"
+#include "atlantis/propagation/views/scalarView.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output = sum(max(0, c_i(x[i]) - n)), where each c_i is a chain of depth
+ * alternating IntOffsetViews and ScalarViews (with factor -1) of x[i], as
+ * the invariant graph builds for shifted and negated terms, and the
+ * comparison against n is a LessEqualConst view at the end of the chain.
+ */
+class ViewChain : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  propagation::VarViewId output{propagation::NULL_ID};
+
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> indexDist;
+  std::uniform_int_distribution<Int> valueDist;
+
+  size_t numVars{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    numVars = static_cast<size_t>(state.range(0));
+    const auto depth = static_cast<size_t>(state.range(1));
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    gen = std::mt19937(rd());
+    const Int ub = static_cast<Int>(numVars);
+    valueDist = std::uniform_int_distribution<Int>(0, ub - 1);
+    indexDist = std::uniform_int_distribution<size_t>(0, numVars - 1);
+
+    inputs.reserve(numVars);
+    std::vector<propagation::VarViewId> violations;
+    violations.reserve(numVars);
+    for (size_t i = 0; i < numVars; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, ub - 1));
+      propagation::VarViewId chain = inputs.back();
+      for (size_t d = 0; d < depth; ++d) {
+        chain = d % 2 == 0
+                    ? solver->makeIntView<propagation::IntOffsetView>(
+                          *solver, chain, static_cast<Int>(i))
+                    : solver->makeIntView<propagation::ScalarView>(
+                          *solver, chain, -1, ub);
+      }
+      violations.emplace_back(solver->makeIntView<propagation::LessEqualConst>(
+          *solver, chain, ub));
+    }
+    output = solver->makeIntVar(0, 0, 0);
+    solver->makeInvariant<propagation::Linear>(*solver, output,
+                                               std::move(violations));
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    solver = nullptr;
+  }
+};
+
+BENCHMARK_DEFINE_F(ViewChain, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[indexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ViewChain, probe_all)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    for (const auto& input : inputs) {
+      solver->setValue(input, valueDist(gen));
+    }
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+// Arguments: {number of variables, depth of the chains}
+static void viewChainArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (int numVars = 16; numVars <= 1024; numVars *= 8) {
+    for (int depth = 0; depth <= 4; depth += 2) {
+      benchmark->Args({numVars, depth});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(ViewChain, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(viewChainArguments);
+
+BENCHMARK_REGISTER_F(ViewChain, probe_all)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(viewChainArguments);
+
+}  // namespace atlantis::benchmark
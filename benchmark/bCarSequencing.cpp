@@ -247,11 +247,62 @@ BENCHMARK_DEFINE_F(CarSequencing, probe_all_swap)(::benchmark::State& st) {
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
 }
 
+BENCHMARK_DEFINE_F(CarSequencing, probe_single_swap_bounded)(::benchmark::State& st) {
+  // Bounded probes are cut off as soon as the total violation provably
+  // exceeds what a Metropolis criterion at a low temperature would accept:
+  const bool bounded = st.range(2) != 0;
+  const double temperature = 1.0;
+  if (bounded && !_solver->setProbeCutoffVar(totalViolation)) {
+    st.SkipWithError("Bounded probes are not supported");
+    return;
+  }
+  size_t probes = 0;
+  size_t cutOffProbes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t i = carDistribution(gen);
+    assert(i < sequence.size());
+    const size_t j = carDistribution(gen);
+    assert(j < sequence.size());
+    const Int oldI = _solver->committedValue(sequence[i]);
+    const Int oldJ = _solver->committedValue(sequence[j]);
+    const Int maxViolation = maxAcceptableCost(
+        _solver->committedValue(totalViolation), temperature, gen);
+    _solver->beginMove();
+    _solver->setValue(sequence[i], oldJ);
+    _solver->setValue(sequence[j], oldI);
+    _solver->endMove();
+
+    _solver->beginProbe();
+    _solver->query(totalViolation);
+    if (bounded) {
+      if (!_solver->endBoundedProbe(maxViolation)) {
+        ++cutOffProbes;
+      }
+    } else {
+      _solver->endProbe();
+      if (_solver->currentValue(totalViolation) > maxViolation) {
+        ++cutOffProbes;
+      }
+    }
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  // The ratio of probes that exceed the threshold (and are cut off if the
+  // probes are bounded):
+  st.counters["rejected_ratio"] =
+      static_cast<double>(cutOffProbes) / static_cast<double>(probes);
+}
+
 //*
 BENCHMARK_REGISTER_F(CarSequencing, probe_single_swap)
     ->Unit(::benchmark::kMillisecond)
     ->Apply(defaultArguments);
 
+BENCHMARK_REGISTER_F(CarSequencing, probe_single_swap_bounded)
+    ->Unit(::benchmark::kMillisecond)
+    ->Apply(boundedProbeArguments);
+
 //*/
 /*
 
@@ -193,11 +193,62 @@ BENCHMARK_DEFINE_F(MagicSquare, probe_all_swap)(::benchmark::State& st) {
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
 }
 
+BENCHMARK_DEFINE_F(MagicSquare, probe_single_swap_bounded)(::benchmark::State& st) {
+  // Bounded probes are cut off as soon as the total violation provably
+  // exceeds what a Metropolis criterion at a low temperature would accept:
+  const bool bounded = st.range(2) != 0;
+  const double temperature = 1.0;
+  if (bounded && !solver->setProbeCutoffVar(totalViolation)) {
+    st.SkipWithError("Bounded probes are not supported");
+    return;
+  }
+  size_t probes = 0;
+  size_t cutOffProbes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t i = distribution(gen);
+    assert(i < flat.size());
+    const size_t j = distribution(gen);
+    assert(j < flat.size());
+    const Int oldI = solver->committedValue(flat[i]);
+    const Int oldJ = solver->committedValue(flat[j]);
+    const Int maxViolation = maxAcceptableCost(
+        solver->committedValue(totalViolation), temperature, gen);
+    solver->beginMove();
+    solver->setValue(flat[i], oldJ);
+    solver->setValue(flat[j], oldI);
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(totalViolation);
+    if (bounded) {
+      if (!solver->endBoundedProbe(maxViolation)) {
+        ++cutOffProbes;
+      }
+    } else {
+      solver->endProbe();
+      if (solver->currentValue(totalViolation) > maxViolation) {
+        ++cutOffProbes;
+      }
+    }
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  // The ratio of probes that exceed the threshold (and are cut off if the
+  // probes are bounded):
+  st.counters["rejected_ratio"] =
+      static_cast<double>(cutOffProbes) / static_cast<double>(probes);
+}
+
 //*
 BENCHMARK_REGISTER_F(MagicSquare, probe_single_swap)
     ->Unit(::benchmark::kMillisecond)
     ->Apply(defaultArguments);
 
+BENCHMARK_REGISTER_F(MagicSquare, probe_single_swap_bounded)
+    ->Unit(::benchmark::kMillisecond)
+    ->Apply(boundedProbeArguments);
+
 //*/
 
 /*
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <random>
+
 #include "atlantis/propagation/solver.hpp"
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/types.hpp"
@@ -70,6 +74,38 @@ inline void defaultArguments(::benchmark::internal::Benchmark* benchmark) {
   }
 }
 
+/**
+ * Arguments {n, mode, bounded} for comparing unbounded probes (bounded = 0)
+ * with bounded probes (bounded = 1). Bounded probes are only supported in
+ * input-to-output mode (mode = 0).
+ */
+inline void boundedProbeArguments(
+    ::benchmark::internal::Benchmark* benchmark) {
+  for (Int n : {16, 32, 64, 128, 256, 512}) {
+    for (Int bounded = 0; bounded <= 1; ++bounded) {
+      benchmark->Args({n, 0, bounded});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+/**
+ * @return the largest cost that a Metropolis criterion at the given
+ * temperature accepts, where the random number is drawn before the move is
+ * probed.
+ */
+inline Int maxAcceptableCost(Int currentCost, double temperature,
+                             std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  const double u = dist(gen);
+  if (u <= 0.0) {
+    return std::numeric_limits<Int>::max();
+  }
+  return currentCost + static_cast<Int>(std::floor(-temperature * std::log(u)));
+}
+
 inline Int int_pow(Int base, Int exponent) {
   if (exponent <= 0) {
     return 1;
@@ -1,11 +1,14 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <queue>
 #include <random>
 #include <utility>
 #include <vector>
 
+#include "atlantis/propagation/propagation/bucketPropagationQueue.hpp"
 #include "atlantis/propagation/propagation/propagationQueue.hpp"
 
 namespace atlantis::benchmark {
@@ -164,6 +167,168 @@ BENCHMARK_DEFINE_F(PropQueue, pop_random)(::benchmark::State& st) {
       static_cast<double>(pops), ::benchmark::Counter::kIsRate);
 }
 
+/**
+ * Adapter of std::priority_queue with the same interface as the propagation
+ * queues (including ignoring duplicates).
+ */
+class STLPropagationQueue {
+  struct PriorityCmp {
+    const std::vector<size_t>& priority;
+    explicit PriorityCmp(const std::vector<size_t>& p) : priority(p) {}
+    bool operator()(propagation::VarId left, propagation::VarId right) const {
+      return priority[left] > priority[right];
+    }
+  };
+
+  std::vector<size_t> _priority;
+  std::vector<bool> _isQueued;
+  std::priority_queue<propagation::VarId, std::vector<propagation::VarId>,
+                      PriorityCmp>
+      _queue;
+
+ public:
+  STLPropagationQueue() : _queue(PriorityCmp(_priority)) {}
+
+  void init(size_t, size_t) {}
+
+  void initVar(propagation::VarId, size_t priority) {
+    _priority.emplace_back(priority);
+    _isQueued.emplace_back(false);
+  }
+
+  [[nodiscard]] bool empty() const { return _queue.empty(); }
+
+  void push(propagation::VarId id) {
+    if (!_isQueued[id]) {
+      _isQueued[id] = true;
+      _queue.push(id);
+    }
+  }
+
+  propagation::VarId pop() {
+    const propagation::VarId id = _queue.top();
+    _queue.pop();
+    _isQueued[id] = false;
+    return id;
+  }
+};
+
+/**
+ * Simulates the enqueue pattern of Solver::propagate on a layered random
+ * DAG: a probe modifies a few search variables (position 0), and each
+ * dequeued variable enqueues the variables it is an input to, which all have
+ * a strictly greater position.
+ *
+ * range(0): the number of variables
+ * range(1): the number of listening variables per variable
+ * range(2): the number of modified search variables per probe
+ */
+class PropQueuePattern : public ::benchmark::Fixture {
+ public:
+  std::mt19937 gen;
+
+  size_t numVars{0};
+  size_t numSearchVars{0};
+  size_t fanOut{0};
+  size_t numModified{0};
+  std::vector<size_t> position;
+  std::vector<std::vector<propagation::VarId>> listeners;
+
+  void SetUp(const ::benchmark::State& st) override {
+    numVars = size_t(st.range(0));
+    fanOut = size_t(st.range(1));
+    numModified = size_t(st.range(2));
+    gen = std::mt19937(0);
+
+    // Wide and shallow: roughly sqrt(numVars) layers of variables.
+    size_t numLayers = 1;
+    while (numLayers * numLayers < numVars) {
+      ++numLayers;
+    }
+    const size_t layerWidth = std::max<size_t>(1, numVars / numLayers);
+    numSearchVars = layerWidth;
+
+    position.resize(numVars);
+    for (size_t i = 0; i < numVars; ++i) {
+      position[i] = i / layerWidth;
+    }
+    listeners.assign(numVars, {});
+    for (size_t i = 0; i < numVars; ++i) {
+      const size_t nextLayerStart = (position[i] + 1) * layerWidth;
+      if (nextLayerStart >= numVars) {
+        continue;
+      }
+      // Listeners are mostly in the next layer, and sometimes further away:
+      std::uniform_int_distribution<size_t> near(
+          nextLayerStart,
+          std::min(numVars - 1, nextLayerStart + layerWidth - 1));
+      std::uniform_int_distribution<size_t> far(nextLayerStart, numVars - 1);
+      for (size_t j = 0; j < fanOut; ++j) {
+        listeners[i].emplace_back(j % 4 == 3 ? far(gen) : near(gen));
+      }
+    }
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    position.clear();
+    listeners.clear();
+  }
+
+  template <class Queue>
+  void run(::benchmark::State& st) {
+    Queue queue;
+    queue.init(numVars, 1);
+    for (size_t i = 0; i < numVars; ++i) {
+      queue.initVar(i, position[i]);
+    }
+    std::uniform_int_distribution<size_t> searchVarDist(0, numSearchVars - 1);
+    size_t dequeued = 0;
+    for ([[maybe_unused]] const auto& _ : st) {
+      for (size_t i = 0; i < numModified; ++i) {
+        queue.push(searchVarDist(gen));
+      }
+      while (!queue.empty()) {
+        const propagation::VarId id = queue.pop();
+        ++dequeued;
+        for (const propagation::VarId listener : listeners[id]) {
+          queue.push(listener);
+        }
+      }
+    }
+    st.counters["dequeued_per_second"] = ::benchmark::Counter(
+        static_cast<double>(dequeued), ::benchmark::Counter::kIsRate);
+  }
+};
+
+BENCHMARK_DEFINE_F(PropQueuePattern, sorted_list)(::benchmark::State& st) {
+  run<propagation::PropagationQueue>(st);
+}
+
+BENCHMARK_DEFINE_F(PropQueuePattern, bucket)(::benchmark::State& st) {
+  run<propagation::BucketPropagationQueue>(st);
+}
+
+BENCHMARK_DEFINE_F(PropQueuePattern, stl_priority_queue)
+(::benchmark::State& st) { run<STLPropagationQueue>(st); }
+
+static void patternArguments(::benchmark::internal::Benchmark* b) {
+  for (int numVars = 1000; numVars <= 100000; numVars *= 10) {
+    for (int fanOut = 1; fanOut <= 4; fanOut *= 2) {
+      for (int numModified : {1, 3, 16}) {
+        b->Args({numVars, fanOut, numModified});
+      }
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(PropQueuePattern, sorted_list)->Apply(patternArguments);
+BENCHMARK_REGISTER_F(PropQueuePattern, bucket)->Apply(patternArguments);
+BENCHMARK_REGISTER_F(PropQueuePattern, stl_priority_queue)
+    ->Apply(patternArguments);
+
 // This benchmark is not a model, but mainly to test the performance
 // of the propagation::PropagationQueue data structure (it typically does not
 // need to be benchmarked)
@@ -4,6 +4,11 @@
 
 namespace atlantis::invariantgraph {
 class ArrayIntMaximumNode : public InvariantNode {
+ public:
+  // The smallest number of inputs for which MaxTournament is used
+  // instead of MaxSparse:
+  static constexpr size_t TOURNAMENT_MIN_ARITY = 32;
+
  private:
   Int _lb;
 
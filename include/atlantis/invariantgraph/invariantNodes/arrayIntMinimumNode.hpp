@@ -4,6 +4,11 @@
 
 namespace atlantis::invariantgraph {
 class ArrayIntMinimumNode : public InvariantNode {
+ public:
+  // The smallest number of inputs for which MinTournament is used
+  // instead of MinSparse:
+  static constexpr size_t TOURNAMENT_MIN_ARITY = 32;
+
  private:
   Int _ub;
 
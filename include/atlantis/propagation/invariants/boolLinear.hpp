@@ -19,6 +19,7 @@ class BoolLinear : public Invariant {
   VarId _output;
   std::vector<Int> _coeffs;
   std::vector<VarViewId> _violArray;
+  bool _inputsAreVars;
 
  public:
   explicit BoolLinear(SolverBase&, VarViewId output,
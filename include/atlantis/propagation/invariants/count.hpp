@@ -1,12 +1,13 @@
 #pragma once
 
 #include <cassert>
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/variables/committableIntVector.hpp"
 #include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
@@ -21,7 +22,8 @@ class Count : public Invariant {
   VarId _output;
   VarViewId _needle;
   std::vector<VarViewId> _vars;
-  std::vector<CommittableInt> _counts;
+  bool _inputsAreVars;
+  CommittableIntVector _counts;
   Int _offset;
   void increaseCount(Timestamp ts, Int value);
   void decreaseCount(Timestamp ts, Int value);
@@ -39,6 +41,8 @@ class Count : public Invariant {
   void close(Timestamp) override;
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
+  [[nodiscard]] bool batchesInputChanges() const override { return true; }
   void commit(Timestamp) override;
   VarViewId nextInput(Timestamp) override;
   void notifyCurrentInputChanged(Timestamp) override;
@@ -49,10 +53,10 @@ inline void Count::increaseCount(Timestamp ts, Int value) {
       static_cast<Int>(_counts.size()) <= value - _offset) {
     return;
   }
-  assert(_counts[value - _offset].value(ts) + 1 > 0);
-  assert(_counts[value - _offset].value(ts) + 1 <=
+  assert(_counts.value(ts, value - _offset) + 1 > 0);
+  assert(_counts.value(ts, value - _offset) + 1 <=
          static_cast<Int>(_vars.size()));
-  _counts[value - _offset].incValue(ts, 1);
+  _counts.incValue(ts, value - _offset, 1);
 }
 
 inline void Count::decreaseCount(Timestamp ts, Int value) {
@@ -60,10 +64,10 @@ inline void Count::decreaseCount(Timestamp ts, Int value) {
       static_cast<Int>(_counts.size()) <= value - _offset) {
     return;
   }
-  assert(_counts[value - _offset].value(ts) - 1 >= 0);
-  assert(_counts[value - _offset].value(ts) - 1 <
+  assert(_counts.value(ts, value - _offset) - 1 >= 0);
+  assert(_counts.value(ts, value - _offset) - 1 <
          static_cast<Int>(_vars.size()));
-  _counts[value - _offset].incValue(ts, -1);
+  _counts.incValue(ts, value - _offset, -1);
 }
 
 inline signed char Count::count(Timestamp ts, Int value) {
@@ -73,7 +77,7 @@ inline signed char Count::count(Timestamp ts, Int value) {
   }
   assert(0 <= value - _offset &&
          static_cast<size_t>(value - _offset) <= _counts.size());
-  return static_cast<signed char>(_counts[value - _offset].value(ts));
+  return static_cast<signed char>(_counts.value(ts, value - _offset));
 }
 
 }  // namespace atlantis::propagation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
@@ -19,6 +20,7 @@ class CountConst : public Invariant {
   VarId _output;
   Int _needle;
   std::vector<VarViewId> _vars;
+  bool _inputsAreVars;
 
  public:
   explicit CountConst(SolverBase&, VarId output, Int needle,
@@ -31,6 +33,8 @@ class CountConst : public Invariant {
   void updateBounds(bool widenOnly) override;
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
+  [[nodiscard]] bool batchesInputChanges() const override { return true; }
   VarViewId nextInput(Timestamp) override;
   void notifyCurrentInputChanged(Timestamp) override;
 };
@@ -5,7 +5,7 @@
 #include "atlantis/propagation/invariants/invariant.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/variables/committableIntVector.hpp"
 #include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
@@ -16,7 +16,7 @@ class GlobalCardinalityOpen : public Invariant {
   std::vector<VarViewId> _inputs;
   std::vector<Int> _cover;
   std::vector<Int> _coverVarIndex;
-  std::vector<CommittableInt> _counts;
+  CommittableIntVector _counts;
   Int _offset;
   void increaseCount(Timestamp ts, Int value);
   void decreaseCountAndUpdateOutput(Timestamp ts, Int value);
@@ -45,7 +45,7 @@ inline void GlobalCardinalityOpen::increaseCount(Timestamp ts, Int value) {
   if (0 <= value - _offset &&
       value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
       _coverVarIndex[value - _offset] >= 0) {
-    _counts[_coverVarIndex[value - _offset]].incValue(ts, 1);
+    _counts.incValue(ts, _coverVarIndex[value - _offset], 1);
   }
 }
 
@@ -55,7 +55,7 @@ inline void GlobalCardinalityOpen::decreaseCountAndUpdateOutput(Timestamp ts,
       value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
       _coverVarIndex[value - _offset] >= 0) {
     updateValue(ts, _outputs[_coverVarIndex[value - _offset]],
-                _counts[_coverVarIndex[value - _offset]].incValue(ts, -1));
+                _counts.incValue(ts, _coverVarIndex[value - _offset], -1));
   }
 }
 
@@ -65,7 +65,7 @@ inline void GlobalCardinalityOpen::increaseCountAndUpdateOutput(Timestamp ts,
       value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
       _coverVarIndex[value - _offset] >= 0) {
     updateValue(ts, _outputs[_coverVarIndex[value - _offset]],
-                _counts[_coverVarIndex[value - _offset]].incValue(ts, 1));
+                _counts.incValue(ts, _coverVarIndex[value - _offset], 1));
   }
 }
 
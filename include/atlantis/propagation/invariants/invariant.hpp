@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cassert>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "atlantis/propagation/types.hpp"
@@ -107,8 +109,42 @@ class Invariant {
    */
   virtual void notifyInputChanged(Timestamp ts, LocalId localId) = 0;
 
+  /**
+   * Used in Input-to-Output propagation to notify that several variables
+   * local to the invariant have had their values changed, in the order
+   * they were dequeued. The default calls notifyInputChanged for each of
+   * them; invariants where the changes can be aggregated override it to
+   * update their outputs once per batch (see batchesInputChanges).
+   * @param ts the current timestamp
+   * @param localIds the local ids of the variables.
+   */
+  virtual void notifyInputsChanged(Timestamp ts,
+                                   std::span<const LocalId> localIds) {
+    for (const LocalId localId : localIds) {
+      notifyInputChanged(ts, localId);
+    }
+  }
+
+  /**
+   * @return true iff the solver should collect the changed inputs of the
+   * invariant and notify them through notifyInputsChanged. Collecting has
+   * a cost, so only invariants that aggregate the changes return true.
+   */
+  [[nodiscard]] virtual bool batchesInputChanges() const { return false; }
+
   virtual void commit(Timestamp) { _isPostponed = false; };
 
+  /**
+   * If the primary defined variable is a weighted sum of input variables
+   * (and nothing else), then the (input, coefficient) terms of the sum are
+   * appended to terms. Used for bounding probes (see ProbeCutoff).
+   * @return true iff the primary defined variable is a weighted sum.
+   */
+  virtual bool linearTerms(
+      std::vector<std::pair<VarViewId, Int>>& /* terms */) const {
+    return false;
+  }
+
   inline void postpone() { _isPostponed = true; }
   [[nodiscard]] inline bool isPostponed() const { return _isPostponed; }
 
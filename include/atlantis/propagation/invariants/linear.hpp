@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
@@ -19,6 +20,9 @@ class Linear : public Invariant {
   VarId _output;
   std::vector<Int> _coeffs;
   std::vector<VarViewId> _varArray;
+  // Whether all inputs are variables (not views), in which case recompute
+  // gathers their values from the store and uses the vectorised kernels:
+  bool _inputsAreVars;
 
  public:
   explicit Linear(SolverBase&, VarViewId output,
@@ -36,8 +40,11 @@ class Linear : public Invariant {
   void updateBounds(bool widenOnly) override;
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
+  [[nodiscard]] bool batchesInputChanges() const override { return true; }
   VarViewId nextInput(Timestamp) override;
   void notifyCurrentInputChanged(Timestamp) override;
+  bool linearTerms(std::vector<std::pair<VarViewId, Int>>&) const override;
 };
 
 }  // namespace atlantis::propagation
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include "atlantis/propagation/invariants/invariant.hpp"
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/tournamentTree.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for output <- max(varArray)
+ *
+ * Same as MaxSparse, but the inputs are kept in a tournament tree, so that
+ * an input change takes logarithmic time also when the maximum gets
+ * smaller. Preferable for large arrays.
+ */
+
+class MaxTournament : public Invariant {
+ private:
+  VarId _output;
+  std::vector<VarViewId> _varArray;
+
+  MaxTournamentTree _localPriority;
+
+ public:
+  explicit MaxTournament(SolverBase&, VarId output,
+                        std::vector<VarViewId>&& varArray);
+
+  explicit MaxTournament(SolverBase&, VarViewId output,
+                        std::vector<VarViewId>&& varArray);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include "atlantis/propagation/invariants/invariant.hpp"
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/tournamentTree.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for output <- min(varArray)
+ *
+ * Same as MinSparse, but the inputs are kept in a tournament tree, so that
+ * an input change takes logarithmic time also when the minimum gets
+ * larger. Preferable for large arrays.
+ */
+
+class MinTournament : public Invariant {
+ private:
+  VarId _output;
+  std::vector<VarViewId> _varArray;
+  MinTournamentTree _localPriority;
+
+ public:
+  explicit MinTournament(SolverBase&, VarId output,
+                        std::vector<VarViewId>&& varArray);
+
+  explicit MinTournament(SolverBase&, VarViewId output,
+                        std::vector<VarViewId>&& varArray);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
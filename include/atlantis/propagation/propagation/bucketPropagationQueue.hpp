@@ -0,0 +1,120 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * A monotone bucket queue over the topological positions of variables.
+ *
+ * During the propagation of a layer, a dequeued variable only enqueues
+ * variables that have a greater (or, for non-primary defined variables, the
+ * same) position. The queue therefore keeps a cursor to the lowest
+ * non-empty bucket that only moves forward while the queue is non-empty,
+ * giving O(1) push and amortised O(1) pop.
+ *
+ * Each bucket is an intrusive singly-linked list over the variables, so no
+ * memory is allocated after init.
+ */
+class BucketPropagationQueue {
+ private:
+  // _bucketHead[p] is the first variable in the bucket of position p:
+  std::vector<VarId> _bucketHead;
+  // _next[id] is the variable after id in its bucket:
+  std::vector<VarId> _next;
+  std::vector<size_t> _priority;
+  std::vector<bool> _isQueued;
+  size_t _cursor{0};
+  size_t _size{0};
+
+ public:
+  BucketPropagationQueue()
+      : _bucketHead(0), _next(0), _priority(0), _isQueued(0) {}
+
+  void init(size_t numVars, size_t) {
+    // Topological positions are always strictly less than the number of
+    // variables:
+    _bucketHead.assign(numVars + 1, NULL_ID);
+    _next.clear();
+    _next.reserve(numVars);
+    _priority.clear();
+    _priority.reserve(numVars);
+    _isQueued.clear();
+    _isQueued.reserve(numVars);
+    _cursor = _bucketHead.size();
+    _size = 0;
+  }
+
+  // vars must be initialised in order.
+  void initVar(VarId id, size_t priority) {
+    assert(id == _priority.size());
+    if (priority >= _bucketHead.size()) {
+      _bucketHead.resize(priority + 1, NULL_ID);
+    }
+    _next.emplace_back(NULL_ID);
+    _priority.emplace_back(priority);
+    _isQueued.emplace_back(false);
+  }
+
+  void updatePriority(VarId id, size_t newPriority) {
+    assert(id < _priority.size());
+    // The priority of a queued variable cannot change as it would need to be
+    // unlinked from its bucket:
+    assert(!_isQueued[id]);
+    if (newPriority >= _bucketHead.size()) {
+      _bucketHead.resize(newPriority + 1, NULL_ID);
+    }
+    _priority[id] = newPriority;
+  }
+
+  [[nodiscard]] bool empty() const { return _size == 0; }
+
+  void push(VarId id) {
+    assert(id < _priority.size());
+    if (_isQueued[id]) {
+      return;
+    }
+    const size_t priority = _priority[id];
+    _isQueued[id] = true;
+    _next[id] = _bucketHead[priority];
+    _bucketHead[priority] = id;
+    // Pushing a variable below the cursor does not happen during the
+    // propagation of a layer, but is allowed between propagations:
+    _cursor = std::min(_cursor, priority);
+    ++_size;
+  }
+
+  VarId pop() {
+    if (_size == 0) {
+      return NULL_ID;
+    }
+    while (_bucketHead[_cursor] == NULL_ID) {
+      ++_cursor;
+      assert(_cursor < _bucketHead.size());
+    }
+    const VarId id = _bucketHead[_cursor];
+    _bucketHead[_cursor] = _next[id];
+    _next[id] = NULL_ID;
+    _isQueued[id] = false;
+    if (--_size == 0) {
+      _cursor = _bucketHead.size();
+    }
+    return id;
+  }
+
+  VarId top() {
+    if (_size == 0) {
+      return NULL_ID;
+    }
+    while (_bucketHead[_cursor] == NULL_ID) {
+      ++_cursor;
+      assert(_cursor < _bucketHead.size());
+    }
+    return _bucketHead[_cursor];
+  }
+};
+
+}  // namespace atlantis::propagation
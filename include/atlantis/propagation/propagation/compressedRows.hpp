@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace atlantis::propagation {
+
+/**
+ * An immutable compressed sparse row (CSR) representation of a
+ * std::vector<std::vector<T>>: all rows are stored back to back in a single
+ * array, and row i is the range [_offsets[i], _offsets[i + 1]) of that array.
+ */
+template <class T>
+class CompressedRows {
+ private:
+  std::vector<size_t> _offsets{0};
+  std::vector<T> _data;
+
+ public:
+  /**
+   * Replaces the content with the given rows. The rows are cleared and their
+   * memory is released.
+   */
+  void compress(std::vector<std::vector<T>>& rows) {
+    _offsets.clear();
+    _offsets.reserve(rows.size() + 1);
+    _offsets.emplace_back(0);
+    size_t numElements = 0;
+    for (const auto& row : rows) {
+      numElements += row.size();
+      _offsets.emplace_back(numElements);
+    }
+    _data.clear();
+    _data.reserve(numElements);
+    for (const auto& row : rows) {
+      for (const T& element : row) {
+        _data.emplace_back(element);
+      }
+    }
+    rows.clear();
+    rows.shrink_to_fit();
+  }
+
+  /**
+   * Moves the content back into the given rows, leaving this empty.
+   */
+  void decompress(std::vector<std::vector<T>>& rows) {
+    rows.clear();
+    rows.reserve(numRows());
+    for (size_t i = 0; i < numRows(); ++i) {
+      rows.emplace_back();
+      rows.back().reserve(_offsets[i + 1] - _offsets[i]);
+      for (size_t j = _offsets[i]; j < _offsets[i + 1]; ++j) {
+        rows.back().emplace_back(_data[j]);
+      }
+    }
+    clear();
+  }
+
+  void clear() {
+    _offsets.assign(1, 0);
+    _offsets.shrink_to_fit();
+    _data.clear();
+    _data.shrink_to_fit();
+  }
+
+  [[nodiscard]] inline size_t numRows() const noexcept {
+    return _offsets.size() - 1;
+  }
+
+  [[nodiscard]] inline size_t numElements() const noexcept {
+    return _data.size();
+  }
+
+  [[nodiscard]] inline std::span<const T> operator[](size_t i) const noexcept {
+    assert(i < numRows());
+    return std::span<const T>(_data.data() + _offsets[i],
+                              _offsets[i + 1] - _offsets[i]);
+  }
+};
+
+}  // namespace atlantis::propagation
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <unordered_set>
 #include <vector>
 
 #include "atlantis/exceptions/exceptions.hpp"
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
 #include "atlantis/propagation/types.hpp"
 
 namespace atlantis::propagation {
@@ -23,8 +23,12 @@ class OutputToInputExplorer {
   std::vector<Timestamp> _invariantComputedAt;
   std::vector<bool> _invariantIsOnStack;
 
-  std::vector<std::unordered_set<VarId>> _searchVarAncestors;
-  std::vector<bool> _onPropagationPath;
+  SearchVarAncestors _searchVarAncestors;
+  // last timestamp when a VarID was marked as being on the propagation path:
+  std::vector<Timestamp> _onPropagationPathAt;
+  // If not NULL_TIMESTAMP, then the marks made since this timestamp are
+  // kept (see beginMarkingBatch):
+  Timestamp _markedSince{NULL_TIMESTAMP};
 
   OutputToInputMarkingMode _outputToInputMarkingMode;
 
@@ -32,7 +36,7 @@ class OutputToInputExplorer {
   void preprocessVarStack([[maybe_unused]] Timestamp);
 
   template <OutputToInputMarkingMode MarkingMode>
-  bool isMarked([[maybe_unused]] VarId);
+  bool isMarked([[maybe_unused]] Timestamp, [[maybe_unused]] VarId);
 
   void pushVarStack(VarId);
   void popVarStack();
@@ -46,14 +50,16 @@ class OutputToInputExplorer {
   // We expand an invariant by pushing it and its first input variable onto
   // the stack.
   template <OutputToInputMarkingMode MarkingMode>
-  void expandInvariant(InvariantId);
+  void expandInvariant(Timestamp, InvariantId);
   void notifyCurrentInvariant();
 
   template <OutputToInputMarkingMode MarkingMode>
-  bool pushNextInputVar();
+  bool pushNextInputVar(Timestamp);
 
+  std::vector<size_t> renumberSearchVars();
   void outputToInputStaticMarking();
-  void inputToOutputExplorationMarking();
+  void inputToOutputExplorationMarking(Timestamp);
+  [[nodiscard]] bool isOnPropagationPath(Timestamp, VarId) const;
 
   template <OutputToInputMarkingMode MarkingMode>
   void propagate(Timestamp);
@@ -71,6 +77,17 @@ class OutputToInputExplorer {
 
   void clearRegisteredVars();
 
+  /**
+   * Keeps the input-to-output exploration marks made from timestamp ts
+   * onwards until endMarkingBatch is called. The marks of a probe batch
+   * thereby accumulate, so that each candidate only marks the search
+   * variables that no previous candidate in the batch has marked. Marking
+   * a superset of the propagation path is sound, it only means that more
+   * variables are explored.
+   */
+  void beginMarkingBatch(Timestamp ts);
+  void endMarkingBatch();
+
   void propagate(Timestamp);
 
   [[nodiscard]] OutputToInputMarkingMode outputToInputMarkingMode() const;
@@ -78,6 +95,11 @@ class OutputToInputExplorer {
 
   template <OutputToInputMarkingMode MarkingMode>
   void close();
+
+  /**
+   * @return the number of bytes that the marking data structures occupy.
+   */
+  [[nodiscard]] size_t markingMemoryUsage() const noexcept;
 };
 
 inline void OutputToInputExplorer::registerForPropagation(Timestamp, VarId id) {
@@ -86,6 +108,21 @@ inline void OutputToInputExplorer::registerForPropagation(Timestamp, VarId id) {
 
 inline void OutputToInputExplorer::clearRegisteredVars() { _varStackIdx = 0; }
 
+inline void OutputToInputExplorer::beginMarkingBatch(Timestamp ts) {
+  _markedSince = ts;
+}
+
+inline void OutputToInputExplorer::endMarkingBatch() {
+  _markedSince = NULL_TIMESTAMP;
+}
+
+inline bool OutputToInputExplorer::isOnPropagationPath(Timestamp ts,
+                                                       VarId id) const {
+  assert(id < _onPropagationPathAt.size());
+  return _onPropagationPathAt[id] >=
+         (_markedSince == NULL_TIMESTAMP ? ts : _markedSince);
+}
+
 inline void OutputToInputExplorer::pushVarStack(VarId id) {
   _varStack[_varStackIdx++] = id;
 }
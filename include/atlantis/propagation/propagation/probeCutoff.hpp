@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+class SolverBase;  // Forward declaration
+
+/**
+ * Monotone lower bound on a variable that is defined as a weighted sum of
+ * other variables (typically the total violation), used for cutting off
+ * input-to-output probes that provably exceed a given value.
+ *
+ * Input-to-output propagation dequeues variables in order of their
+ * topological position, and the value of a variable is final once all its
+ * inputs have been dequeued. Hence, when a variable at position p has been
+ * dequeued, a term of the sum is final unless its source variable is
+ * enqueued (pending) or at a position after p. The remaining terms have
+ * been notified to the sum, so:
+ *
+ *   bound = current value of the sum
+ *           - slack(pending terms) - slack(terms at positions after p)
+ *
+ * where the slack of a term is its committed value minus its smallest
+ * possible value. The slack of the pending terms is tracked as terms are
+ * enqueued and dequeued, and the slack of the terms after p is tracked as
+ * the propagation advances through the positions, so the bound is computed
+ * in amortised constant time.
+ */
+class ProbeCutoff {
+ public:
+  struct Term {
+    size_t position;
+    VarId source;
+    VarViewId var;
+    Int coeff;
+  };
+
+ private:
+  SolverBase& _solver;
+
+  VarId _var{NULL_ID};
+  // The terms, ordered by the position and id of their source variables:
+  std::vector<VarViewId> _terms{};
+  std::vector<VarId> _sources{};
+  std::vector<size_t> _termLevels{};
+  std::vector<Int> _coeffs{};
+  // The smallest value of each term given the bounds of its variable:
+  std::vector<Int> _minTermValues{};
+  // The committed value of each term minus its smallest value:
+  std::vector<Int> _committedSlack{};
+  Int _totalSlack{0};
+
+  // The distinct positions of the terms (in increasing order) and the
+  // committed slack of the terms at each position:
+  std::vector<size_t> _levelPositions{};
+  std::vector<Int> _levelSlack{};
+
+  // For each variable: one past the index of the last term with the
+  // variable as source, or 0 if the variable is not the source of a term:
+  std::vector<size_t> _termsEnd{};
+  // For each variable: the committed slack of the terms with the variable
+  // as source:
+  std::vector<Int> _sourceSlack{};
+
+  // The committed slack of the terms whose sources are pending:
+  Int _pendingSlack{0};
+  // The first level that has not been passed by the propagation, and the
+  // committed slack of the terms at that level or after it:
+  size_t _level{0};
+  Int _laterSlack{0};
+
+ public:
+  explicit ProbeCutoff(SolverBase&);
+
+  /**
+   * Initialises the bound for the variable var, which is the weighted sum
+   * of the given terms.
+   * @param var the variable to bound.
+   * @param terms the terms of var.
+   * @param numVars the number of variables in the solver.
+   */
+  void init(VarId var, std::vector<Term>&& terms, size_t numVars);
+
+  void clear();
+
+  [[nodiscard]] inline bool isActive() const noexcept {
+    return _var != NULL_ID;
+  }
+
+  [[nodiscard]] inline VarId var() const noexcept { return _var; }
+
+  [[nodiscard]] inline bool isTermSource(VarId id) const noexcept {
+    return size_t(id) < _termsEnd.size() && _termsEnd[id] != 0;
+  }
+
+  /**
+   * Resets the pending terms and the passed positions, at the start of a
+   * new timestamp.
+   */
+  inline void reset() noexcept {
+    _pendingSlack = 0;
+    _level = 0;
+    _laterSlack = _totalSlack;
+  }
+
+  /**
+   * Notifies that the term source id has been enqueued for propagation.
+   */
+  inline void enqueued(VarId id) noexcept {
+    if (isTermSource(id)) {
+      _pendingSlack += _sourceSlack[id];
+    }
+  }
+
+  /**
+   * Notifies that the term source id has been dequeued for propagation.
+   */
+  inline void dequeued(VarId id) noexcept {
+    assert(isTermSource(id));
+    _pendingSlack -= _sourceSlack[id];
+  }
+
+  /**
+   * @return a lower bound on the value of var at timestamp ts, given that
+   * all variables up to the given position have been dequeued, except the
+   * pending ones. The position must not decrease between calls during the
+   * same timestamp (see reset).
+   */
+  [[nodiscard]] Int lowerBound(Timestamp ts, size_t position);
+
+  /**
+   * Updates the committed values of the terms that have id as source.
+   */
+  void commit(VarId id);
+};
+
+}  // namespace atlantis::propagation
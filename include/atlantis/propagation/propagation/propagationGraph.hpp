@@ -1,7 +1,10 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
+#include "atlantis/propagation/propagation/bucketPropagationQueue.hpp"
+#include "atlantis/propagation/propagation/compressedRows.hpp"
 #include "atlantis/propagation/propagation/propagationQueue.hpp"
 #include "atlantis/propagation/store/store.hpp"
 #include "atlantis/types.hpp"
@@ -62,6 +65,18 @@ class PropagationGraph {
   // Map from VarID -> vector of InvariantID
   std::vector<std::vector<ListeningInvariantData>> _listeningInvariantData;
 
+  // When the graph is closed, the three adjacency lists above are frozen into
+  // compressed rows (and the nested vectors are released). They are thawed
+  // again if anything is registered after the graph has been closed. The
+  // listening invariants of each variable are frozen in topological order.
+  bool _isFrozen{false};
+  CompressedRows<VarId> _frozenVarsDefinedByInvariant;
+  CompressedRows<std::pair<VarId, bool>> _frozenInputVars;
+  CompressedRows<ListeningInvariantData> _frozenListeningInvariantData;
+
+  void freeze();
+  void thaw();
+
   std::vector<std::vector<VarId>> _varsInLayer;
   struct LayerIndex {
     size_t layer;
@@ -72,6 +87,18 @@ class PropagationGraph {
   std::vector<size_t> _layerPositionOffset{};
   std::vector<bool> _layerHasDynamicCycle{};
   bool _hasDynamicCycle{false};
+
+  // For each dynamic invariant in a layer with dynamic cycles: the dynamic
+  // input that the current topological order respects.
+  std::vector<VarId> _orderedDynamicInput{};
+  // For each layer with dynamic cycles: the dynamic invariants whose ordered
+  // dynamic input might differ from their committed dynamic input.
+  std::vector<std::vector<InvariantId>> _uncommittedDynamicInvariants{};
+  std::vector<bool> _isUncommittedDynamicInvariant{};
+  // Scratch space for updateTopologicalOrder:
+  std::vector<InvariantId> _changedDynamicInvariants{};
+  std::vector<std::pair<InvariantId, size_t>> _raiseStack{};
+
   size_t _numInvariants{0};
   size_t _numVars{0};
 
@@ -88,6 +115,8 @@ class PropagationGraph {
                           VarId varId);
   void topologicallyOrder(Timestamp ts, size_t layer, bool updatePriorityQueue);
   void topologicallyOrder(Timestamp ts);
+  bool raisePositions(InvariantId invariantId, size_t position,
+                      size_t& budget);
 
   struct PriorityCmp {
     PropagationGraph& graph;
@@ -97,7 +126,9 @@ class PropagationGraph {
     }
   };
 
+  PropagationQueueType _propagationQueueType;
   PropagationQueue _propagationQueue;
+  BucketPropagationQueue _bucketPropagationQueue;
 
   [[nodiscard]] inline VarId dynamicInputVar(
       Timestamp ts, InvariantId invariantId) const noexcept {
@@ -105,7 +136,9 @@ class PropagationGraph {
   }
 
  public:
-  explicit PropagationGraph(const Store& store, size_t expectedSize = 1000u);
+  explicit PropagationGraph(
+      const Store& store, size_t expectedSize = 1000u,
+      PropagationQueueType queueType = PropagationQueueType::BUCKET);
 
   /**
    * update internal datastructures based on currently registered  variables and
@@ -150,6 +183,26 @@ class PropagationGraph {
     topologicallyOrder(ts, layer, true);
   }
 
+  /**
+   * @brief repairs the topological order of a layer with dynamic cycles
+   * after the dynamic inputs of its invariants might have changed.
+   *
+   * Instead of ordering the whole layer again, only the invariants whose
+   * dynamic input differs from the one that the current order respects
+   * are considered, and the positions of the variables they define (and of
+   * the variables that transitively depend on them) are raised until the
+   * order is valid again. Positions are never lowered, so the order is
+   * only recomputed from scratch when a position would grow out of bounds
+   * or the repair would be more expensive than ordering the layer.
+   *
+   * @param ts the timestamp of the dynamic inputs.
+   * @param layer the layer, which must have dynamic cycles.
+   * @param modifiedVars the primary defined variables of the invariants in
+   * the layer that have been notified at ts.
+   */
+  void updateTopologicalOrder(Timestamp ts, size_t layer,
+                              std::span<const VarId> modifiedVars);
+
   [[nodiscard]] inline size_t numVars() const {
     return _numVars;  // this ignores null var
   }
@@ -178,19 +231,28 @@ class PropagationGraph {
     return _definingInvariant.at(id);
   }
 
-  [[nodiscard]] inline const std::vector<VarId>& varsDefinedBy(
+  [[nodiscard]] inline std::span<const VarId> varsDefinedBy(
       InvariantId invariantId) const {
-    return _varsDefinedByInvariant.at(invariantId);
+    assert(invariantId < numInvariants());
+    return _isFrozen ? _frozenVarsDefinedByInvariant[invariantId]
+                     : std::span<const VarId>(
+                           _varsDefinedByInvariant[invariantId]);
   }
 
-  [[nodiscard]] inline const std::vector<ListeningInvariantData>&
+  [[nodiscard]] inline std::span<const ListeningInvariantData>
   listeningInvariantData(VarId id) const {
-    return _listeningInvariantData.at(id);
+    assert(id < numVars());
+    return _isFrozen ? _frozenListeningInvariantData[id]
+                     : std::span<const ListeningInvariantData>(
+                           _listeningInvariantData[id]);
   }
 
-  [[nodiscard]] inline const std::vector<std::pair<VarId, bool>>& inputVars(
+  [[nodiscard]] inline std::span<const std::pair<VarId, bool>> inputVars(
       InvariantId invariantId) const {
-    return _inputVars.at(invariantId);
+    assert(invariantId < numInvariants());
+    return _isFrozen ? _frozenInputVars[invariantId]
+                     : std::span<const std::pair<VarId, bool>>(
+                           _inputVars[invariantId]);
   }
 
   [[nodiscard]] inline const std::vector<VarId>& searchVars() const {
@@ -201,20 +263,33 @@ class PropagationGraph {
     return _evaluationVars;
   }
 
+  [[nodiscard]] inline PropagationQueueType propagationQueueType()
+      const noexcept {
+    return _propagationQueueType;
+  }
+
   inline void clearPropagationQueue() {
-    while (!_propagationQueue.empty()) {
-      _propagationQueue.pop();
+    if (_propagationQueueType == PropagationQueueType::BUCKET) {
+      while (!_bucketPropagationQueue.empty()) {
+        _bucketPropagationQueue.pop();
+      }
+    } else {
+      while (!_propagationQueue.empty()) {
+        _propagationQueue.pop();
+      }
     }
   }
 
   [[nodiscard]] inline bool propagationQueueEmpty() {
-    return _propagationQueue.empty();
+    return _propagationQueueType == PropagationQueueType::BUCKET
+               ? _bucketPropagationQueue.empty()
+               : _propagationQueue.empty();
   }
 
   [[nodiscard]] inline VarId dequeuePropagationQueue() {
-    VarId id = _propagationQueue.top();
-    _propagationQueue.pop();
-    return id;
+    return _propagationQueueType == PropagationQueueType::BUCKET
+               ? _bucketPropagationQueue.pop()
+               : _propagationQueue.pop();
   }
 
   [[nodiscard]] bool hasDynamicCycle() const noexcept {
@@ -254,11 +329,17 @@ class PropagationGraph {
   }
 
   inline size_t invariantPosition(InvariantId invariantId) {
-    assert(!_varsDefinedByInvariant.at(invariantId).empty());
-    return _varPosition.at(_varsDefinedByInvariant.at(invariantId).front());
+    assert(!varsDefinedBy(invariantId).empty());
+    return _varPosition.at(varsDefinedBy(invariantId).front());
   }
 
-  inline void enqueuePropagationQueue(VarId id) { _propagationQueue.push(id); }
+  inline void enqueuePropagationQueue(VarId id) {
+    if (_propagationQueueType == PropagationQueueType::BUCKET) {
+      _bucketPropagationQueue.push(id);
+    } else {
+      _propagationQueue.push(id);
+    }
+  }
 };
 
 }  // namespace atlantis::propagation
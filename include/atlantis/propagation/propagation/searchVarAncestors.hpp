@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "atlantis/propagation/propagation/compressedRows.hpp"
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * For each variable, the set of search variables that are transitive
+ * ancestors of the variable.
+ *
+ * The search variables are renumbered (see searchVarIndex) and each set is
+ * stored as a sparse bitset over the renumbered search variables: a sorted
+ * list of 64-bit blocks, where only the non-empty blocks are stored. When
+ * the search variables are numbered such that search variables with common
+ * descendants are numbered consecutively, most sets consist of a few dense
+ * blocks.
+ *
+ * The modified search variables are stored in the same representation, so
+ * testing whether a variable has a modified ancestor is a word-parallel
+ * intersection of two sorted block lists.
+ */
+class SearchVarAncestors {
+ public:
+  struct Block {
+    size_t index;
+    uint64_t bits;
+  };
+
+  static constexpr size_t BLOCK_SIZE = 64;
+  static constexpr size_t NOT_A_SEARCH_VAR = ~size_t(0);
+
+ private:
+  // Map from VarId -> renumbered search variable (or NOT_A_SEARCH_VAR):
+  std::vector<size_t> _searchVarIndex{};
+  CompressedRows<Block> _ancestors{};
+  // The blocks of the modified search variables, sorted by index:
+  std::vector<Block> _modified{};
+
+ public:
+  /**
+   * Replaces the content.
+   * @param searchVarIndex the renumbered search variable of each variable.
+   * @param ancestors the blocks of the set of each variable, sorted by
+   * index. The rows are cleared and their memory is released.
+   */
+  void assign(std::vector<size_t>&& searchVarIndex,
+              std::vector<std::vector<Block>>& ancestors);
+
+  void clear();
+
+  [[nodiscard]] inline size_t numVars() const noexcept {
+    return _ancestors.numRows();
+  }
+
+  [[nodiscard]] inline size_t searchVarIndex(VarId id) const noexcept {
+    assert(id < _searchVarIndex.size());
+    return _searchVarIndex[id];
+  }
+
+  /**
+   * Sets the modified search variables.
+   */
+  void setModified(const std::unordered_set<VarId>& modifiedSearchVars);
+
+  /**
+   * @return true iff the variable has a modified search variable (see
+   * setModified) as ancestor.
+   */
+  [[nodiscard]] inline bool hasModifiedAncestor(VarId id) const {
+    assert(id < numVars());
+    const std::span<const Block> blocks = _ancestors[id];
+    if (_modified.size() == 1) {
+      // The common case of a single modified block is a binary search:
+      const auto it = std::lower_bound(
+          blocks.begin(), blocks.end(), _modified.front().index,
+          [](const Block& block, size_t index) { return block.index < index; });
+      return it != blocks.end() && it->index == _modified.front().index &&
+             (it->bits & _modified.front().bits) != 0;
+    }
+    auto it = blocks.begin();
+    for (const Block& modified : _modified) {
+      while (it != blocks.end() && it->index < modified.index) {
+        ++it;
+      }
+      if (it == blocks.end()) {
+        return false;
+      }
+      if (it->index == modified.index && (it->bits & modified.bits) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @return the number of bytes that the sets occupy.
+   */
+  [[nodiscard]] size_t memoryUsage() const noexcept;
+};
+
+}  // namespace atlantis::propagation
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <limits>
+#include <span>
 #include <unordered_set>
 #include <vector>
 
 #include "atlantis/exceptions/exceptions.hpp"
 #include "atlantis/propagation/propagation/outputToInputExplorer.hpp"
+#include "atlantis/propagation/propagation/probeCutoff.hpp"
 #include "atlantis/propagation/propagation/propagationGraph.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/utils/hashes.hpp"
@@ -22,23 +25,90 @@ class Solver : public SolverBase {
   PropagationGraph _propGraph;
   OutputToInputExplorer _outputToInputExplorer;
 
-  std::vector<bool> _isEnqueued;
+  // A variable is enqueued iff it was enqueued at the current timestamp, so
+  // that the flags do not have to be reset at each new timestamp:
+  std::vector<Timestamp> _enqueuedAt;
   std::vector<std::vector<VarId>> _layerQueue{};
   std::vector<size_t> _layerQueueIndex{};
 
   std::unordered_set<VarId> _modifiedSearchVars;
 
+  // The variables dequeued (in order) during the most recent input-to-output
+  // probe, and the timestamp of that probe (NULL_TIMESTAMP if the probe cannot
+  // be committed):
+  std::vector<VarId> _probedVars{};
+  Timestamp _probedAt{NULL_TIMESTAMP};
+
+  // The source variables of the queried variables of a probe batch:
+  std::vector<VarId> _batchQueries{};
+
+  // Bounded probing (see setProbeCutoffVar and endBoundedProbe):
+  VarViewId _probeCutoffVarId{NULL_ID};
+  ProbeCutoff _probeCutoff;
+  Int _probeCutoffValue{std::numeric_limits<Int>::max()};
+  Int _probeCutoffLowerBound{std::numeric_limits<Int>::min()};
+  bool _probeWasCutOff{false};
+
+  // Input-to-output probing collects the changed inputs of an invariant and
+  // notifies them in one batch (see Invariant::notifyInputsChanged) when the
+  // primary defined variable of the invariant is dequeued. Committing
+  // propagation notifies immediately, as it commits each dequeued variable
+  // before the invariants listening to it would be flushed. Only invariants
+  // with at least BATCH_MIN_INPUTS inputs are batched, as the others seldom
+  // have more than one changed input:
+  static constexpr size_t BATCH_MIN_INPUTS = 32;
+
+  // Most invariants only have a single pending local id, which is stored in
+  // first. Any further pending local ids of all invariants are appended to
+  // _pendingInputs (which is cleared for each propagation, so that it stays
+  // small and in the cache), where the ones of the same invariant are linked
+  // from head to tail. The pending local ids of an invariant are only valid
+  // if its round is the current _propagationRound:
+  struct PendingInput {
+    LocalId localId;
+    uint32_t next;
+  };
+  struct PendingNotifications {
+    LocalId first{0};
+    uint32_t head{0};
+    uint32_t tail{0};
+    uint32_t count{0};
+    uint32_t round{0};
+    // Invariants with few inputs, invariants that do not batch their input
+    // changes, dynamic invariants, and the invariant defining the probe
+    // cut-off variable are notified immediately:
+    bool isBatched{false};
+  };
+  std::vector<PendingNotifications> _pendingNotifications{};
+  std::vector<PendingInput> _pendingInputs{};
+  // The local ids of the batch that is being notified:
+  std::vector<LocalId> _notifiedInputs{};
+  uint32_t _propagationRound{0};
+
+  void initProbeCutoff();
+
+  void initPendingNotifications();
+
+  inline void addPendingInput(InvariantId, LocalId);
+  inline void notifyPendingInputs(InvariantId, Invariant&);
+
   void incCurrentTimestamp();
 
   void closeInvariants();
 
   void clearPropagationQueue();
 
+  [[nodiscard]] inline bool isEnqueued(VarId) const;
+  inline void setEnqueued(VarId);
+
   void propagateOnClose();
 
   template <CommitMode Mode, bool SingleLayer>
   void propagate();
 
+  // Propagates the current move without committing it:
+  void propagateProbe();
+
   void outputToInputPropagate();
 
   /**
@@ -51,7 +121,12 @@ class Solver : public SolverBase {
   void registerDefinedVar(VarId definedVarId, InvariantId invariantId) final;
 
  public:
-  Solver(/* args */);
+  /**
+   * @param queueType the data structure of the propagation queue used during
+   * input-to-output propagation.
+   */
+  explicit Solver(
+      PropagationQueueType queueType = PropagationQueueType::BUCKET);
 
   void open() final;
   void close() final;
@@ -61,6 +136,12 @@ class Solver : public SolverBase {
   OutputToInputMarkingMode outputToInputMarkingMode() const;
   void setOutputToInputMarkingMode(OutputToInputMarkingMode);
 
+  /**
+   * @return the number of bytes that the data structures of the
+   * output-to-input marking occupy.
+   */
+  [[nodiscard]] size_t outputToInputMarkingMemoryUsage() const;
+
   //--------------------- Notification ---------------------
   /***
    * @param id the id of the changed variable
@@ -72,6 +153,10 @@ class Solver : public SolverBase {
     return _propagationMode;
   }
 
+  [[nodiscard]] inline PropagationQueueType propagationQueueType() const {
+    return _propGraph.propagationQueueType();
+  }
+
   // --------------------- Activity ----------------
   [[nodiscard]] VarId dequeueComputedVar(Timestamp);
 
@@ -93,6 +178,79 @@ class Solver : public SolverBase {
   void endProbe();
   void query(VarViewId);
 
+  /**
+   * Probes numCandidates moves in a single probe session, which is
+   * equivalent to (but cheaper than) performing the sequence beginMove,
+   * setValue, endMove, beginProbe, query, endProbe for each candidate.
+   * The solver state is only checked once, the queried variables are only
+   * resolved once, and in the input-to-output exploration marking mode the
+   * marks are shared by all candidates of the batch.
+   *
+   * For each candidate index i, setCandidate(i) sets the values of the
+   * candidate through setValue, and after the candidate has been
+   * propagated onProbed(i) is called, which can read the probed values
+   * through currentValue. Each candidate is probed at its own timestamp,
+   * and the last candidate can be committed through commitProbe().
+   *
+   * @param queries The variables to query for each candidate.
+   * @param numCandidates The number of candidates in the batch.
+   * @param setCandidate Callback that sets the values of a candidate.
+   * @param onProbed Callback that is invoked after a candidate is probed.
+   */
+  template <typename SetCandidate, typename OnProbed>
+  void probeBatch(std::span<const VarViewId> queries, size_t numCandidates,
+                  SetCandidate&& setCandidate, OnProbed&& onProbed);
+
+  /**
+   * @return true iff the most recent probe was performed at timestamp ts
+   * and can be committed by commitProbe(), that is, the solver is idle and
+   * nothing has been moved, probed, or committed since that probe.
+   */
+  [[nodiscard]] inline bool canCommitProbe(Timestamp ts) const noexcept {
+    return ts != NULL_TIMESTAMP && ts == _probedAt &&
+           ts == _currentTimestamp && _solverState == SolverState::IDLE &&
+           _propagationMode == PropagationMode::INPUT_TO_OUTPUT;
+  }
+
+  /**
+   * Commits the state of the most recent probe without propagating it
+   * again: only the variables (and their defining invariants) that were
+   * visited by the probe are committed.
+   * Requires canCommitProbe(currentTimestamp()).
+   */
+  void commitProbe();
+
+  /**
+   * Sets the variable that bounded probes (see endBoundedProbe) are cut off
+   * on. Bounded probes are only supported in input-to-output mode, when
+   * the propagation graph has a single layer and when id is a variable
+   * that is defined as a weighted sum (e.g., by a Linear invariant).
+   * @return true iff bounded probes are supported for id.
+   */
+  bool setProbeCutoffVar(VarViewId id);
+
+  [[nodiscard]] inline bool canBoundProbes() const noexcept {
+    return _probeCutoff.isActive() &&
+           _propagationMode == PropagationMode::INPUT_TO_OUTPUT;
+  }
+
+  /**
+   * Like endProbe, but stops propagating as soon as the value of the probe
+   * cut-off variable provably exceeds maxValue. A probe that was cut off
+   * cannot be committed by commitProbe, and only the lower bound of the
+   * cut-off variable (see probeCutoffLowerBound) is known.
+   * @return false iff the probe was cut off.
+   */
+  bool endBoundedProbe(Int maxValue);
+
+  /**
+   * @return the lower bound of the probe cut-off variable that exceeded
+   * the maximum value of the most recent bounded probe that was cut off.
+   */
+  [[nodiscard]] inline Int probeCutoffLowerBound() const noexcept {
+    return _probeCutoffLowerBound;
+  }
+
   void beginCommit();
   void endCommit();
 
@@ -100,8 +258,9 @@ class Solver : public SolverBase {
   size_t numInvariants() const;
 
   [[nodiscard]] const std::vector<VarId>& searchVars() const;
+  [[nodiscard]] const std::vector<VarId>& evaluationVars() const;
   [[nodiscard]] const std::unordered_set<VarId>& modifiedSearchVar() const;
-  [[nodiscard]] const std::vector<std::pair<VarId, bool>>& inputVars(
+  [[nodiscard]] std::span<const std::pair<VarId, bool>> inputVars(
       InvariantId) const;
 
   /**
@@ -114,9 +273,9 @@ class Solver : public SolverBase {
   // This function is used by propagation, which is unaware of views.
   [[nodiscard]] inline bool hasChanged(Timestamp, VarId) const;
 
-  [[nodiscard]] const std::vector<VarId>& varsDefinedBy(InvariantId) const;
+  [[nodiscard]] std::span<const VarId> varsDefinedBy(InvariantId) const;
 
-  [[nodiscard]] const std::vector<PropagationGraph::ListeningInvariantData>&
+  [[nodiscard]] std::span<const PropagationGraph::ListeningInvariantData>
       listeningInvariantData(VarId) const;
 
   /**
@@ -141,15 +300,69 @@ inline void Solver::incCurrentTimestamp() {
   ++_currentTimestamp;
   if (_propagationMode == PropagationMode::INPUT_TO_OUTPUT) {
     clearPropagationQueue();
+    _probeCutoff.reset();
   } else {
     _modifiedSearchVars.clear();
   }
   assert(std::all_of(
       searchVars().begin(), searchVars().end(), [&](const VarId varId) {
-        return !_store.intVar(varId).hasChanged(_currentTimestamp);
+        return !_store.hasChanged(_currentTimestamp, varId);
       }));
 }
 
+inline bool Solver::isEnqueued(VarId id) const {
+  assert(id < _enqueuedAt.size());
+  return _enqueuedAt[id] == _currentTimestamp;
+}
+
+inline void Solver::setEnqueued(VarId id) {
+  assert(id < _enqueuedAt.size());
+  _enqueuedAt[id] = _currentTimestamp;
+}
+
+inline void Solver::addPendingInput(InvariantId invariantId, LocalId localId) {
+  assert(invariantId < _pendingNotifications.size());
+  PendingNotifications& pending = _pendingNotifications[invariantId];
+  if (pending.round != _propagationRound || pending.count == 0) {
+    pending.round = _propagationRound;
+    pending.first = localId;
+    pending.count = 1;
+    return;
+  }
+  const auto index = static_cast<uint32_t>(_pendingInputs.size());
+  _pendingInputs.emplace_back(PendingInput{localId, index});
+  if (pending.count == 1) {
+    pending.head = index;
+  } else {
+    _pendingInputs[pending.tail].next = index;
+  }
+  pending.tail = index;
+  ++pending.count;
+}
+
+inline void Solver::notifyPendingInputs(InvariantId invariantId,
+                                        Invariant& invariant) {
+  assert(invariantId < _pendingNotifications.size());
+  PendingNotifications& pending = _pendingNotifications[invariantId];
+  if (pending.round != _propagationRound || pending.count == 0) {
+    return;
+  }
+  if (pending.count == 1) {
+    pending.count = 0;
+    invariant.notifyInputChanged(_currentTimestamp, pending.first);
+    return;
+  }
+  _notifiedInputs.clear();
+  _notifiedInputs.emplace_back(pending.first);
+  for (uint32_t index = pending.head; _notifiedInputs.size() < pending.count;
+       index = _pendingInputs[index].next) {
+    assert(index < _pendingInputs.size());
+    _notifiedInputs.emplace_back(_pendingInputs[index].localId);
+  }
+  pending.count = 0;
+  invariant.notifyInputsChanged(_currentTimestamp, _notifiedInputs);
+}
+
 inline size_t Solver::numVars() const { return _propGraph.numVars(); }
 
 inline size_t Solver::numInvariants() const {
@@ -160,12 +373,12 @@ inline InvariantId Solver::definingInvariant(VarViewId id) const {
   return _propGraph.definingInvariant(id.isView() ? sourceId(id) : VarId(id));
 }
 
-inline const std::vector<VarId>& Solver::varsDefinedBy(
+inline std::span<const VarId> Solver::varsDefinedBy(
     InvariantId invariantId) const {
   return _propGraph.varsDefinedBy(invariantId);
 }
 
-inline const std::vector<PropagationGraph::ListeningInvariantData>&
+inline std::span<const PropagationGraph::ListeningInvariantData>
 Solver::listeningInvariantData(VarId id) const {
   return _propGraph.listeningInvariantData(id);
 }
@@ -178,7 +391,7 @@ inline void Solver::notifyCurrentInputChanged(InvariantId invariantId) {
 }
 
 inline bool Solver::hasChanged(Timestamp ts, VarId id) const {
-  return _store.constIntVar(id).hasChanged(ts);
+  return _store.hasChanged(ts, id);
 }
 
 inline void Solver::setValue(Timestamp ts, VarViewId id, Int val) {
@@ -189,15 +402,14 @@ inline void Solver::setValue(Timestamp ts, VarViewId id, Int val) {
 inline void Solver::setValue(Timestamp ts, VarId id, Int val) {
   assert(_propGraph.isSearchVar(id));
 
-  IntVar& var = _store.intVar(id);
-  var.setValue(ts, val);
+  _store.setValue(ts, id, val);
 
   if (_propagationMode == PropagationMode::OUTPUT_TO_INPUT) {
     if (ts != _currentTimestamp) {
       _modifiedSearchVars.clear();
     }
 
-    if (var.hasChanged(ts)) {
+    if (_store.hasChanged(ts, id)) {
       _modifiedSearchVars.emplace(id);
     } else {
       _modifiedSearchVars.erase(id);
@@ -218,6 +430,10 @@ inline OutputToInputMarkingMode Solver::outputToInputMarkingMode() const {
   return _outputToInputExplorer.outputToInputMarkingMode();
 }
 
+inline size_t Solver::outputToInputMarkingMemoryUsage() const {
+  return _outputToInputExplorer.markingMemoryUsage();
+}
+
 inline void Solver::setOutputToInputMarkingMode(
     OutputToInputMarkingMode markingMode) {
   if (!_isOpen) {
@@ -231,7 +447,11 @@ inline const std::vector<VarId>& Solver::searchVars() const {
   return _propGraph.searchVars();
 }
 
-inline const std::vector<std::pair<VarId, bool>>& Solver::inputVars(
+inline const std::vector<VarId>& Solver::evaluationVars() const {
+  return _propGraph.evaluationVars();
+}
+
+inline std::span<const std::pair<VarId, bool>> Solver::inputVars(
     InvariantId invariantId) const {
   return _propGraph.inputVars(invariantId);
 }
@@ -240,6 +460,45 @@ inline const std::unordered_set<VarId>& Solver::modifiedSearchVar() const {
   return _modifiedSearchVars;
 }
 
+template <typename SetCandidate, typename OnProbed>
+void Solver::probeBatch(std::span<const VarViewId> queries,
+                        size_t numCandidates, SetCandidate&& setCandidate,
+                        OnProbed&& onProbed) {
+  assert(!_isOpen);
+  assert(_solverState == SolverState::IDLE);
+
+  _batchQueries.clear();
+  if (_propagationMode != PropagationMode::INPUT_TO_OUTPUT) {
+    for (const VarViewId id : queries) {
+      _batchQueries.emplace_back(sourceId(id));
+    }
+  }
+
+  try {
+    for (size_t i = 0; i < numCandidates; ++i) {
+      incCurrentTimestamp();
+      if (i == 0) {
+        // The exploration marks of the candidates are accumulated:
+        _outputToInputExplorer.beginMarkingBatch(_currentTimestamp);
+      }
+      _solverState = SolverState::MOVE;
+      setCandidate(i);
+      _solverState = SolverState::PROCESSING;
+      for (const VarId id : _batchQueries) {
+        _outputToInputExplorer.registerForPropagation(_currentTimestamp, id);
+      }
+      propagateProbe();
+      onProbed(i);
+    }
+    _outputToInputExplorer.endMarkingBatch();
+    _solverState = SolverState::IDLE;
+  } catch (std::exception const& e) {
+    _outputToInputExplorer.endMarkingBatch();
+    _solverState = SolverState::IDLE;
+    throw e;
+  }
+}
+
 inline void Solver::outputToInputPropagate() {
   assert(propagationMode() == PropagationMode::OUTPUT_TO_INPUT);
   _outputToInputExplorer.propagate(_currentTimestamp);
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <cassert>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 #include "atlantis/exceptions/exceptions.hpp"
 #include "atlantis/propagation/store/store.hpp"
+#include "atlantis/propagation/views/intViewKey.hpp"
 #include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
@@ -28,6 +31,23 @@ class SolverBase {
 
   Store _store;
 
+  // The key of each view (of kind NONE if the view has no key), and the id
+  // of the view with each key. They are used to fuse chains of views and to
+  // deduplicate views when the views are made:
+  std::vector<IntViewKey> _intViewKeys;
+  std::unordered_map<IntViewKey, VarViewId, IntViewKeyHash> _intViewIds;
+
+  /**
+   * @return an existing view with the given key, or a new view (directly
+   * over the source of a chain of views) that is equivalent to a view with
+   * the given key. Returns NULL_ID if there is no such view.
+   */
+  VarViewId normalisedIntView(const IntViewKey&);
+
+  VarViewId makeAffineView(VarViewId parentId, Int factor, Int offset);
+
+  void registerIntViewKey(VarViewId viewId, const IntViewKey&);
+
   void incValue(Timestamp, VarId, Int inc);
   inline void incValue(VarId id, Int val) {
     incValue(_currentTimestamp, id, val);
@@ -82,6 +102,16 @@ class SolverBase {
 
   [[nodiscard]] Int committedValue(VarViewId);
 
+  /**
+   * Writes the value at ts of each of the ids into values, for invariants
+   * that recompute their output over many inputs at once.
+   * @param ids the ids, which must all be variables (not views).
+   */
+  inline void gatherValues(Timestamp ts, std::span<const VarViewId> ids,
+                           std::span<Int> values) const noexcept {
+    _store.gatherValues(ts, ids, values);
+  }
+
   [[nodiscard]] Timestamp tmpTimestamp(VarViewId) const;
 
   [[nodiscard]] bool isPostponed(InvariantId) const;
@@ -95,16 +125,16 @@ class SolverBase {
 
   [[nodiscard]] inline Int lowerBound(VarViewId id) const {
     return id.isView() ? _store.constIntView(ViewId(id)).lowerBound()
-                       : _store.constIntVar(VarId(id)).lowerBound();
+                       : _store.lowerBound(VarId(id));
   }
 
   [[nodiscard]] inline Int upperBound(VarViewId id) const {
     return id.isView() ? _store.constIntView(ViewId(id)).upperBound()
-                       : _store.constIntVar(VarId(id)).upperBound();
+                       : _store.upperBound(VarId(id));
   }
 
   inline void updateBounds(VarId id, Int lb, Int ub, bool widenOnly) {
-    _store.intVar(id).updateBounds(lb, ub, widenOnly);
+    _store.updateBounds(id, lb, ub, widenOnly);
   }
 
   void commitInvariantIf(Timestamp, InvariantId);
@@ -125,6 +155,9 @@ class SolverBase {
   /**
    * Register an IntView in the solver and return its pointer.
    * This also sets the id of the IntView to the new id.
+   * If the view has a key (see IntViewKey), then the id of an identical
+   * existing view is returned instead, and a view over another affine view
+   * is fused into a single view over the source of the chain when possible.
    * @param args the constructor arguments of the IntView
    * @return the created IntView.
    */
@@ -148,6 +181,12 @@ class SolverBase {
    */
   VarViewId makeIntVar(Int initValue, Int lowerBound, Int upperBound);
 
+  /**
+   * Hints the solver of the number of variables, invariants, and views that
+   * are about to be created, so that they can be allocated up front.
+   */
+  void reserve(size_t numVars, size_t numInvariants, size_t numIntViews);
+
   /**
    * Register that a variable is a input to an invariant.
    * @param invariantId the invariant
@@ -170,8 +209,8 @@ SolverBase::makeInvariant(Args&&... args) {
   if (!_isOpen) {
     throw SolverClosedException("Cannot make invariant when store is closed.");
   }
-  const InvariantId invariantId = _store.createInvariantFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+  const InvariantId invariantId =
+      _store.createInvariant<T>(std::forward<Args>(args)...);
   registerInvariant(invariantId);
 
   T& invariant = static_cast<T&>(_store.invariant(invariantId));
@@ -188,9 +227,18 @@ SolverBase::makeIntView(Args&&... args) {
   }
   // We don't actually register views as they are invisible to propagation.
 
-  const VarViewId viewId = _store.createIntViewFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+  IntViewKey key;
+  if constexpr (requires { T::key(args...); }) {
+    key = T::key(args...);
+    const VarViewId normalisedId = normalisedIntView(key);
+    if (normalisedId != NULL_ID) {
+      return normalisedId;
+    }
+  }
+  const VarViewId viewId =
+      _store.createIntView<T>(std::forward<Args>(args)...);
   _store.intView(ViewId(viewId)).init(ViewId(viewId));
+  registerIntViewKey(viewId, key);
   return viewId;
 }
 
@@ -200,8 +248,8 @@ SolverBase::makeViolationInvariant(Args&&... args) {
   if (!_isOpen) {
     throw SolverClosedException("Cannot make invariant when store is closed.");
   }
-  const InvariantId violationInvId = _store.createInvariantFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+  const InvariantId violationInvId =
+      _store.createInvariant<T>(std::forward<Args>(args)...);
   T& violationInvariant = static_cast<T&>(_store.invariant(violationInvId));
   // A violation invariant is a type of invariant:
   registerInvariant(violationInvId);
@@ -218,22 +266,21 @@ inline Timestamp SolverBase::currentTimestamp() const {
 }
 
 inline bool SolverBase::hasChanged(Timestamp ts, VarId id) {
-  return _store.intVar(id).hasChanged(ts);
+  return _store.hasChanged(ts, id);
 }
 
 inline Int SolverBase::value(Timestamp ts, VarViewId id) {
   return id.isView() ? _store.intView(ViewId(id)).value(ts)
-                     : _store.constIntVar(VarId(id)).value(ts);
+                     : _store.value(ts, VarId(id));
 }
 
 inline Int SolverBase::committedValue(VarViewId id) {
   return id.isView() ? _store.intView(ViewId(id)).committedValue()
-                     : _store.constIntVar(VarId(id)).committedValue();
+                     : _store.committedValue(VarId(id));
 }
 
 inline Timestamp SolverBase::tmpTimestamp(VarViewId id) const {
-  return _store.constIntVar(id.isView() ? sourceId(id) : VarId(id))
-      .tmpTimestamp();
+  return _store.tmpTimestamp(id.isView() ? sourceId(id) : VarId(id));
 }
 
 inline bool SolverBase::isPostponed(InvariantId invariantId) const {
@@ -249,21 +296,21 @@ inline void SolverBase::recompute(Timestamp ts, InvariantId invariantId) {
 }
 
 inline void SolverBase::updateValue(Timestamp ts, VarId id, Int val) {
-  _store.intVar(id).setValue(ts, val);
+  _store.setValue(ts, id, val);
 }
 
 inline void SolverBase::incValue(Timestamp ts, VarId id, Int inc) {
-  _store.intVar(id).incValue(ts, inc);
+  _store.incValue(ts, id, inc);
 }
 
-inline void SolverBase::commit(VarId id) { _store.intVar(id).commit(); }
+inline void SolverBase::commit(VarId id) { _store.commit(id); }
 
 inline void SolverBase::commitIf(Timestamp ts, VarId id) {
-  _store.intVar(id).commitIf(ts);
+  _store.commitIf(ts, id);
 }
 
 inline void SolverBase::commitValue(VarId id, Int val) {
-  _store.intVar(id).commitValue(val);
+  _store.commitValue(id, val);
 }
 
 inline void SolverBase::commitInvariantIf(Timestamp ts,
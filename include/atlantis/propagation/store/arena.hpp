@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace atlantis::propagation {
+
+/**
+ * A bump allocator that places objects contiguously, in creation order, in
+ * a (small) number of memory blocks.
+ *
+ * The arena never runs any destructors: the owner is responsible for
+ * destroying the created objects before the arena itself is destroyed, at
+ * which point all memory is freed at once.
+ */
+class Arena {
+ private:
+  static constexpr size_t MIN_BLOCK_SIZE = size_t{1} << 12;
+  static constexpr size_t MAX_BLOCK_SIZE = size_t{1} << 22;
+
+  std::vector<std::unique_ptr<std::byte[]>> _blocks;
+  std::byte* _cursor{nullptr};
+  size_t _remaining{0};
+  size_t _nextBlockSize{MIN_BLOCK_SIZE};
+  size_t _numObjects{0};
+
+  void allocateBlock(size_t minSize) {
+    const size_t blockSize = std::max(minSize, _nextBlockSize);
+    _blocks.emplace_back(new std::byte[blockSize]);
+    _cursor = _blocks.back().get();
+    _remaining = blockSize;
+    _nextBlockSize = std::min(MAX_BLOCK_SIZE, 2 * _nextBlockSize);
+  }
+
+  void* allocate(size_t size, size_t alignment) {
+    assert(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(_cursor) %
+                                      alignment) %
+                     alignment;
+    if (_cursor == nullptr || padding + size > _remaining) {
+      allocateBlock(size);
+      padding = 0;
+    }
+    void* ptr = _cursor + padding;
+    _cursor += padding + size;
+    _remaining -= padding + size;
+    ++_numObjects;
+    return ptr;
+  }
+
+ public:
+  Arena() = default;
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena(Arena&&) = default;
+  Arena& operator=(Arena&&) = default;
+
+  /**
+   * Ensures that the next numBytes bytes can be allocated without allocating
+   * any further blocks.
+   */
+  void reserve(size_t numBytes) {
+    if (numBytes > _remaining) {
+      allocateBlock(numBytes);
+    }
+  }
+
+  template <class T, typename... Args>
+  T* create(Args&&... args) {
+    return ::new (allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+  }
+
+  [[nodiscard]] size_t numBlocks() const noexcept { return _blocks.size(); }
+  [[nodiscard]] size_t numObjects() const noexcept { return _numObjects; }
+};
+
+}  // namespace atlantis::propagation
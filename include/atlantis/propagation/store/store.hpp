@@ -1,63 +1,240 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
-#include "atlantis/propagation/variables/intVar.hpp"
+#include "atlantis/propagation/store/arena.hpp"
+#include "atlantis/propagation/types.hpp"
 #include "atlantis/propagation/views/intView.hpp"
+#include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
 
 class Store {
  private:
-  std::vector<IntVar> _intVars;
-  std::vector<std::unique_ptr<Invariant>> _invariants;
-  std::vector<std::unique_ptr<IntView>> _intViews;
+  // The state of the int variables is stored as a structure of arrays, where
+  // index i of each array belongs to the variable with id i. This way, the
+  // propagation only brings the state it reads (typically the timestamps and
+  // values) into the cache:
+  std::vector<Timestamp> _intVarTmpTimestamp;
+  std::vector<Int> _intVarTmpValue;
+  std::vector<Int> _intVarCommittedValue;
+  std::vector<Int> _intVarLowerBound;
+  std::vector<Int> _intVarUpperBound;
+
+  // Invariants and views are allocated in separate arenas, so that each kind
+  // is laid out contiguously in creation order. The store owns the objects
+  // and destroys them before the arenas free their memory:
+  Arena _invariantArena;
+  Arena _intViewArena;
+  std::vector<Invariant*> _invariants;
+  std::vector<IntView*> _intViews;
   std::vector<VarId> _intViewSourceId;
 
+  // Rough estimates of the average size (in bytes) of an invariant and of a
+  // view, used to reserve arena memory from capacity hints:
+  static constexpr size_t ESTIMATED_INVARIANT_SIZE = 192;
+  static constexpr size_t ESTIMATED_INT_VIEW_SIZE = 48;
+
  public:
   Store(size_t estimatedSize, [[maybe_unused]] size_t nullId)
-      : _intVars(), _invariants(), _intViews(), _intViewSourceId() {
-    _intVars.reserve(estimatedSize);
+      : _intVarTmpTimestamp(),
+        _intVarTmpValue(),
+        _intVarCommittedValue(),
+        _intVarLowerBound(),
+        _intVarUpperBound(),
+        _invariantArena(),
+        _intViewArena(),
+        _invariants(),
+        _intViews(),
+        _intViewSourceId() {
+    _intVarTmpTimestamp.reserve(estimatedSize);
+    _intVarTmpValue.reserve(estimatedSize);
+    _intVarCommittedValue.reserve(estimatedSize);
+    _intVarLowerBound.reserve(estimatedSize);
+    _intVarUpperBound.reserve(estimatedSize);
     _invariants.reserve(estimatedSize);
     _intViews.reserve(estimatedSize);
     _intViewSourceId.reserve(estimatedSize);
   }
 
+  Store(const Store&) = delete;
+  Store& operator=(const Store&) = delete;
+  Store(Store&&) = delete;
+  Store& operator=(Store&&) = delete;
+
+  ~Store() {
+    for (auto iter = _intViews.rbegin(); iter != _intViews.rend(); ++iter) {
+      (*iter)->~IntView();
+    }
+    for (auto iter = _invariants.rbegin(); iter != _invariants.rend();
+         ++iter) {
+      (*iter)->~Invariant();
+    }
+  }
+
+  /**
+   * Reserves capacity for (at least) the given number of additional
+   * variables, invariants, and views.
+   */
+  void reserve(size_t numVars, size_t numInvariants, size_t numIntViews) {
+    _intVarTmpTimestamp.reserve(_intVarTmpTimestamp.size() + numVars);
+    _intVarTmpValue.reserve(_intVarTmpValue.size() + numVars);
+    _intVarCommittedValue.reserve(_intVarCommittedValue.size() + numVars);
+    _intVarLowerBound.reserve(_intVarLowerBound.size() + numVars);
+    _intVarUpperBound.reserve(_intVarUpperBound.size() + numVars);
+    _invariants.reserve(_invariants.size() + numInvariants);
+    _invariantArena.reserve(numInvariants * ESTIMATED_INVARIANT_SIZE);
+    _intViews.reserve(_intViews.size() + numIntViews);
+    _intViewSourceId.reserve(_intViewSourceId.size() + numIntViews);
+    _intViewArena.reserve(numIntViews * ESTIMATED_INT_VIEW_SIZE);
+  }
+
   [[nodiscard]] inline VarViewId createIntVar(Timestamp ts, Int initValue,
                                               Int lowerBound, Int upperBound) {
-    VarId vId(_intVars.size());
-    const VarViewId newId = VarViewId(vId, false);
-    _intVars.emplace_back(ts, vId, initValue, lowerBound, upperBound);
+    if (lowerBound > upperBound) {
+      throw std::out_of_range(
+          "Lower bound must be smaller than or equal to upper bound");
+    }
+    if (initValue < lowerBound || upperBound < initValue) {
+      throw std::out_of_range("value must be inside bounds");
+    }
+    const VarViewId newId = VarViewId(VarId(numVars()), false);
+    _intVarTmpTimestamp.emplace_back(ts);
+    _intVarTmpValue.emplace_back(initValue);
+    _intVarCommittedValue.emplace_back(initValue);
+    _intVarLowerBound.emplace_back(lowerBound);
+    _intVarUpperBound.emplace_back(upperBound);
     return newId;
   }
-  [[nodiscard]] inline InvariantId createInvariantFromPtr(
-      std::unique_ptr<Invariant>&& ptr) {
+
+  template <class T, typename... Args>
+  [[nodiscard]] inline InvariantId createInvariant(Args&&... args) {
     auto newId = InvariantId(_invariants.size());
+    T* ptr = _invariantArena.create<T>(std::forward<Args>(args)...);
     ptr->setId(newId);
-    _invariants.emplace_back(std::move(ptr));
+    _invariants.emplace_back(ptr);
     return newId;
   }
 
-  [[nodiscard]] inline VarViewId createIntViewFromPtr(
-      std::unique_ptr<IntView>&& ptr) {
+  template <class T, typename... Args>
+  [[nodiscard]] inline VarViewId createIntView(Args&&... args) {
     const VarViewId newId = VarViewId(_intViews.size(), true);
+    T* ptr = _intViewArena.create<T>(std::forward<Args>(args)...);
     ptr->setId(ViewId(newId));
     const VarViewId parentId = ptr->parentId();
     const VarViewId source =
         parentId.isVar() ? parentId : _intViewSourceId[size_t(parentId)];
-    _intViews.emplace_back(std::move(ptr));
+    _intViews.emplace_back(ptr);
     _intViewSourceId.emplace_back(VarId(source));
     return newId;
   }
 
-  inline IntVar& intVar(VarId id) { return _intVars[id]; }
+  //--------------------- IntVar state ---------------------
+
+  [[gnu::always_inline]] [[nodiscard]] inline bool hasChanged(
+      Timestamp ts, VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarTmpTimestamp[id] == ts &&
+           _intVarTmpValue[id] != _intVarCommittedValue[id];
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Timestamp tmpTimestamp(
+      VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarTmpTimestamp[id];
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int value(
+      Timestamp ts, VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarTmpTimestamp[id] == ts ? _intVarTmpValue[id]
+                                         : _intVarCommittedValue[id];
+  }
+
+  // Writes the value at ts of each variable in ids into values. The ids must
+  // all be variables (not views):
+  inline void gatherValues(Timestamp ts, std::span<const VarViewId> ids,
+                           std::span<Int> values) const noexcept {
+    assert(ids.size() <= values.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+      assert(ids[i].isVar());
+      const size_t id = size_t(ids[i]);
+      assert(id < numVars());
+      values[i] = _intVarTmpTimestamp[id] == ts ? _intVarTmpValue[id]
+                                                : _intVarCommittedValue[id];
+    }
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int committedValue(
+      VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarCommittedValue[id];
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int lowerBound(
+      VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarLowerBound[id];
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int upperBound(
+      VarId id) const noexcept {
+    assert(id < numVars());
+    return _intVarUpperBound[id];
+  }
+
+  [[gnu::always_inline]] inline void setValue(Timestamp ts, VarId id,
+                                              Int value) noexcept {
+    assert(id < numVars());
+    _intVarTmpTimestamp[id] = ts;
+    _intVarTmpValue[id] = value;
+  }
 
-  [[nodiscard]] inline const IntVar& constIntVar(VarId id) const {
-    return _intVars.at(id);
+  [[gnu::always_inline]] inline void incValue(Timestamp ts, VarId id,
+                                              Int inc) noexcept {
+    assert(id < numVars());
+    _intVarTmpValue[id] = value(ts, id) + inc;
+    _intVarTmpTimestamp[id] = ts;
   }
 
+  [[gnu::always_inline]] inline void commit(VarId id) noexcept {
+    assert(id < numVars());
+    _intVarCommittedValue[id] = _intVarTmpValue[id];
+  }
+
+  [[gnu::always_inline]] inline void commitIf(Timestamp ts, VarId id) noexcept {
+    assert(id < numVars());
+    if (_intVarTmpTimestamp[id] == ts) {
+      _intVarCommittedValue[id] = _intVarTmpValue[id];
+    }
+  }
+
+  [[gnu::always_inline]] inline void commitValue(VarId id, Int value) noexcept {
+    assert(id < numVars());
+    _intVarCommittedValue[id] = value;
+  }
+
+  inline void updateBounds(VarId id, Int lowerBound, Int upperBound,
+                           bool widenOnly) {
+    assert(id < numVars());
+    Int& lb = _intVarLowerBound[id];
+    Int& ub = _intVarUpperBound[id];
+    lb = widenOnly ? std::min(lb, lowerBound) : lowerBound;
+    ub = widenOnly ? std::max(ub, upperBound) : upperBound;
+    if (lb > ub) {
+      throw std::out_of_range(
+          "Lower bound must be smaller than or equal to upper bound");
+    }
+  }
+
+  //--------------------- Invariants and views ---------------------
+
   inline IntView& intView(ViewId id) { return *(_intViews[id]); }
 
   [[nodiscard]] const inline IntView& constIntView(ViewId id) const {
@@ -83,23 +260,31 @@ class Store {
     return *(_invariants.at(invariantId));
   }
 
-  inline std::vector<IntVar>::iterator intVarBegin() {
-    return _intVars.begin();
-  }
-  inline std::vector<IntVar>::iterator intVarEnd() { return _intVars.end(); }
-  inline std::vector<std::unique_ptr<Invariant>>::iterator invariantBegin() {
+  inline std::vector<Invariant*>::iterator invariantBegin() {
     return _invariants.begin();
   }
-  inline std::vector<std::unique_ptr<Invariant>>::iterator invariantEnd() {
+  inline std::vector<Invariant*>::iterator invariantEnd() {
     return _invariants.end();
   }
 
-  [[nodiscard]] inline size_t numVars() const { return _intVars.size(); }
+  [[nodiscard]] inline size_t numVars() const {
+    return _intVarTmpTimestamp.size();
+  }
 
   [[nodiscard]] inline size_t numInvariants() const {
     return _invariants.size();
   }
 
+  [[nodiscard]] inline size_t numIntViews() const { return _intViews.size(); }
+
+  /**
+   * The number of memory blocks the invariants and views have been allocated
+   * in.
+   */
+  [[nodiscard]] inline size_t numArenaBlocks() const {
+    return _invariantArena.numBlocks() + _intViewArena.numBlocks();
+  }
+
   [[nodiscard]] inline VarId dynamicInputVar(
       Timestamp ts, InvariantId invariantId) const noexcept {
     return sourceId(_invariants.at(invariantId)->dynamicInputVar(ts));
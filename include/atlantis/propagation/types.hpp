@@ -75,6 +75,13 @@ enum class OutputToInputMarkingMode : char {
   OUTPUT_TO_INPUT_STATIC
 };
 
+enum class PropagationQueueType : bool {
+  // Sorted singly-linked list (O(n) push in the worst case):
+  SORTED_LIST,
+  // Monotone bucket queue over the topological positions (O(1) push/pop):
+  BUCKET
+};
+
 enum class ObjectiveDirection : char { MINIMIZE = 1, MAXIMIZE = -1, NONE = 0 };
 
 }  // namespace atlantis::propagation
\ No newline at end of file
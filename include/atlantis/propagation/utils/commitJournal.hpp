@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * The indices of the elements of a container of committable values that
+ * have been modified during a timestamp, so that committing the container
+ * takes time proportional to the number of modified elements instead of
+ * its size.
+ *
+ * An element is recorded the first time it is modified during the
+ * timestamp, which is detected by the element itself not yet having the
+ * timestamp as its temporary timestamp. Elements that are (re)initialised
+ * with a timestamp must therefore be recorded with touchAll.
+ */
+class CommitJournal {
+ private:
+  Timestamp _timestamp{NULL_TIMESTAMP};
+  std::vector<size_t> _indices{};
+
+ public:
+  /**
+   * Records that the element at index is modified at timestamp ts.
+   * @param ts the timestamp of the modification.
+   * @param index the index of the element.
+   * @param tmpTimestamp the temporary timestamp of the element before the
+   * modification.
+   */
+  [[gnu::always_inline]] inline void touch(Timestamp ts, size_t index,
+                                           Timestamp tmpTimestamp) {
+    if (_timestamp != ts) {
+      _timestamp = ts;
+      _indices.clear();
+    } else if (tmpTimestamp == ts) {
+      // Already recorded:
+      return;
+    }
+    _indices.emplace_back(index);
+  }
+
+  /**
+   * Records that the elements at indices [0, size) are modified at
+   * timestamp ts.
+   */
+  inline void touchAll(Timestamp ts, size_t size) {
+    _timestamp = ts;
+    _indices.resize(size);
+    std::iota(_indices.begin(), _indices.end(), size_t(0));
+  }
+
+  inline void clear() {
+    _timestamp = NULL_TIMESTAMP;
+    _indices.clear();
+  }
+
+  /**
+   * @return the indices of the elements that were modified at timestamp ts.
+   */
+  [[nodiscard]] inline std::span<const size_t> modified(
+      Timestamp ts) const noexcept {
+    if (_timestamp != ts) {
+      return {};
+    }
+    return _indices;
+  }
+};
+
+}  // namespace atlantis::propagation
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation::kernels {
+
+/**
+ * Arithmetic kernels over contiguous arrays of values, used by the
+ * invariants to recompute their outputs over many inputs at once.
+ *
+ * On x86-64 (with GCC or Clang), the kernels use AVX2 if the processor
+ * supports it, which is checked once at run time so that the solver does
+ * not have to be compiled for AVX2. Otherwise, they fall back on scalar
+ * loops with independent accumulators. The kernels compute modulo 2^64, so
+ * they agree with the loops they replace whenever those do not overflow.
+ */
+
+// The number of values that an invariant gathers from the store at a time
+// before handing them to a kernel:
+static constexpr size_t CHUNK_SIZE = 256;
+
+/**
+ * @return sum(coeffs[i] * values[i]).
+ */
+[[nodiscard]] Int dotProduct(std::span<const Int> coeffs,
+                             std::span<const Int> values) noexcept;
+
+/**
+ * @return the number of values that are equal to needle.
+ */
+[[nodiscard]] Int countEqual(std::span<const Int> values, Int needle) noexcept;
+
+/**
+ * @return sum(coeffs[i] for each i where values[i] == needle).
+ */
+[[nodiscard]] Int sumWhereEqual(std::span<const Int> coeffs,
+                                std::span<const Int> values,
+                                Int needle) noexcept;
+
+/**
+ * @return true iff the AVX2 kernels are used.
+ */
+[[nodiscard]] bool usesAvx2() noexcept;
+
+}  // namespace atlantis::propagation::kernels
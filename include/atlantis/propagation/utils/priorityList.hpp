@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "atlantis/propagation/utils/commitJournal.hpp"
 #include "atlantis/propagation/variables/committable.hpp"
 #include "atlantis/types.hpp"
 
@@ -10,6 +11,7 @@ namespace atlantis::propagation {
 class PriorityList {
  private:
   std::vector<Committable<Int>> _list;
+  CommitJournal _journal;
   Committable<size_t> _minimum;
   Committable<size_t> _maximum;
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "atlantis/propagation/utils/commitJournal.hpp"
+#include "atlantis/propagation/variables/committable.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * A list of priorities that maintains its largest (IsMax) or smallest
+ * (!IsMax) priority, with the same temporary and committed semantics as
+ * PriorityList.
+ *
+ * The priorities are the leaves of a complete binary tree, where each inner
+ * node holds the best priority of its children. Updating a priority takes
+ * O(log n) time, also when the best priority gets worse, and the best
+ * priority is read from the root in constant time. Committing only visits
+ * the nodes that were modified during the timestamp.
+ */
+template <bool IsMax>
+class TournamentTree {
+ private:
+  size_t _size;
+  // The index of the first leaf, which is also the number of leaves:
+  size_t _firstLeaf;
+  // The root is at index 1 and the children of node i are at 2i and 2i + 1:
+  std::vector<Committable<Int>> _nodes;
+  CommitJournal _journal;
+
+  [[nodiscard]] static inline Int best(Int a, Int b) noexcept {
+    if constexpr (IsMax) {
+      return a < b ? b : a;
+    } else {
+      return b < a ? b : a;
+    }
+  }
+
+  inline void set(Timestamp ts, size_t node, Int value) {
+    _journal.touch(ts, node, _nodes[node].tmpTimestamp());
+    _nodes[node].set(ts, value);
+  }
+
+ public:
+  explicit TournamentTree(size_t size);
+
+  [[nodiscard]] inline size_t size() const noexcept { return _size; }
+
+  [[nodiscard]] inline Int priority(Timestamp ts, size_t idx) const noexcept {
+    assert(idx < _size);
+    return _nodes[_firstLeaf + idx].get(ts);
+  }
+
+  /**
+   * @return the largest (IsMax) or smallest (!IsMax) priority.
+   */
+  [[nodiscard]] inline Int top(Timestamp ts) const noexcept {
+    return _nodes[1].get(ts);
+  }
+
+  void updatePriority(Timestamp ts, size_t idx, Int newValue);
+
+  void commitIf(Timestamp ts);
+};
+
+using MaxTournamentTree = TournamentTree<true>;
+using MinTournamentTree = TournamentTree<false>;
+
+}  // namespace atlantis::propagation
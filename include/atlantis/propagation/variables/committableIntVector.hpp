@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/commitJournal.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * A vector of committable integers, where committing only visits the
+ * elements that were modified during the timestamp (see CommitJournal).
+ */
+class CommittableIntVector {
+ private:
+  std::vector<CommittableInt> _values{};
+  CommitJournal _journal{};
+
+ public:
+  [[nodiscard]] inline size_t size() const noexcept { return _values.size(); }
+
+  [[nodiscard]] inline bool empty() const noexcept { return _values.empty(); }
+
+  inline void clear() {
+    _values.clear();
+    _journal.clear();
+  }
+
+  /**
+   * Resizes the vector, where the new elements have the given value, and
+   * (re)initialises all elements at timestamp ts.
+   */
+  inline void resize(Timestamp ts, size_t size, Int value) {
+    _values.resize(size, CommittableInt(ts, value));
+    _journal.touchAll(ts, size);
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int value(
+      Timestamp ts, size_t index) const noexcept {
+    assert(index < _values.size());
+    return _values[index].value(ts);
+  }
+
+  [[gnu::always_inline]] [[nodiscard]] inline Int committedValue(
+      size_t index) const noexcept {
+    assert(index < _values.size());
+    return _values[index].committedValue();
+  }
+
+  [[gnu::always_inline]] inline Int setValue(Timestamp ts, size_t index,
+                                             Int newValue) {
+    assert(index < _values.size());
+    _journal.touch(ts, index, _values[index].tmpTimestamp());
+    return _values[index].setValue(ts, newValue);
+  }
+
+  [[gnu::always_inline]] inline Int incValue(Timestamp ts, size_t index,
+                                             Int inc) {
+    assert(index < _values.size());
+    _journal.touch(ts, index, _values[index].tmpTimestamp());
+    return _values[index].incValue(ts, inc);
+  }
+
+  /**
+   * Commits the elements that were modified at timestamp ts.
+   */
+  inline void commitIf(Timestamp ts) {
+    for (const size_t index : _journal.modified(ts)) {
+      _values[index].commitIf(ts);
+    }
+  }
+};
+
+}  // namespace atlantis::propagation
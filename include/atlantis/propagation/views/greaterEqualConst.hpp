@@ -14,6 +14,11 @@ class GreaterEqualConst : public IntView {
  public:
   explicit GreaterEqualConst(SolverBase& solver, VarViewId parentId, Int val);
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId,
+                                      Int val) {
+    return {IntViewKind::GREATER_EQUAL_CONST, parentId, val, 0};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
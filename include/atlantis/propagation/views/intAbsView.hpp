@@ -11,6 +11,10 @@ class IntAbsView : public IntView {
  public:
   IntAbsView(SolverBase& solver, VarViewId parentId);
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId) {
+    return {IntViewKind::ABS, parentId, 0, 0};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
@@ -14,6 +14,11 @@ class IntOffsetView : public IntView {
  public:
   explicit IntOffsetView(SolverBase& solver, VarViewId parentId, Int offset);
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId,
+                                      Int offset) {
+    return {IntViewKind::OFFSET, parentId, offset, 0};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/views/intViewKey.hpp"
 #include "atlantis/propagation/views/view.hpp"
 #include "atlantis/types.hpp"
 
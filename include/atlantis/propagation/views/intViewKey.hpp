@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+enum class IntViewKind : std::uint8_t {
+  NONE,
+  OFFSET,
+  SCALAR,
+  ABS,
+  MOD,
+  EQUAL_CONST,
+  NOT_EQUAL_CONST,
+  LESS_EQUAL_CONST,
+  GREATER_EQUAL_CONST
+};
+
+/**
+ * Describes an IntView as a function of its parent with (at most) two
+ * constant arguments. Two views with equal keys are the same function of the
+ * same parent, which lets the solver deduplicate them and fuse chains of
+ * them into a single view. Views that cannot be described this way have the
+ * kind NONE.
+ */
+struct IntViewKey {
+  IntViewKind kind{IntViewKind::NONE};
+  VarViewId parentId{NULL_ID};
+  Int arg0{0};
+  Int arg1{0};
+
+  [[nodiscard]] inline bool operator==(const IntViewKey& other) const {
+    return kind == other.kind && parentId == other.parentId &&
+           arg0 == other.arg0 && arg1 == other.arg1;
+  }
+};
+
+struct IntViewKeyHash {
+  std::size_t operator()(const IntViewKey& key) const noexcept {
+    std::size_t hash = size_t(key.parentId);
+    hash = hash * 31 + static_cast<std::size_t>(key.kind);
+    hash = hash * 31 + std::hash<Int>{}(key.arg0);
+    return hash * 31 + std::hash<Int>{}(key.arg1);
+  }
+};
+
+}  // namespace atlantis::propagation
@@ -14,6 +14,11 @@ class ModView : public IntView {
  public:
   explicit ModView(SolverBase& solver, VarViewId parentId, Int denominator);
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId,
+                                      Int denominator) {
+    return {IntViewKind::MOD, parentId, denominator, 0};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
@@ -15,6 +15,11 @@ class NotEqualConst : public IntView {
   explicit NotEqualConst(SolverBase& solver, VarViewId parentId, Int val)
       : IntView(solver, parentId), _val(val) {}
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId,
+                                      Int val) {
+    return {IntViewKind::NOT_EQUAL_CONST, parentId, val, 0};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
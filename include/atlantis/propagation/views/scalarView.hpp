@@ -16,6 +16,11 @@ class ScalarView : public IntView {
   explicit ScalarView(SolverBase& solver, VarViewId parentId, Int factor,
                       Int offset = 0);
 
+  [[nodiscard]] static IntViewKey key(SolverBase&, VarViewId parentId,
+                                      Int factor, Int offset = 0) {
+    return {IntViewKind::SCALAR, parentId, factor, offset};
+  }
+
   [[nodiscard]] Int value(Timestamp) override;
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
@@ -1,10 +1,11 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/variables/committableIntVector.hpp"
 #include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
 #include "atlantis/types.hpp"
 
@@ -13,7 +14,7 @@ namespace atlantis::propagation {
 class AllDifferent : public ViolationInvariant {
  protected:
   std::vector<VarViewId> _vars;
-  std::vector<CommittableInt> _counts;
+  CommittableIntVector _counts;
   Int _offset;
   signed char increaseCount(Timestamp ts, Int value);
   signed char decreaseCount(Timestamp ts, Int value);
@@ -30,6 +31,8 @@ class AllDifferent : public ViolationInvariant {
   void close(Timestamp) override;
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
+  [[nodiscard]] bool batchesInputChanges() const override { return true; }
   void commit(Timestamp) override;
   VarViewId nextInput(Timestamp) override;
   void notifyCurrentInputChanged(Timestamp) override;
@@ -39,20 +42,20 @@ inline signed char AllDifferent::increaseCount(Timestamp ts, Int value) {
   if (value < _offset || static_cast<Int>(_counts.size()) <= value - _offset) {
     return 0;
   }
-  assert(_counts[value - _offset].value(ts) + 1 >= 0);
-  assert(_counts[value - _offset].value(ts) + 1 <=
+  assert(_counts.value(ts, value - _offset) + 1 >= 0);
+  assert(_counts.value(ts, value - _offset) + 1 <=
          static_cast<Int>(_vars.size()));
-  return _counts[value - _offset].incValue(ts, 1) >= 2 ? 1 : 0;
+  return _counts.incValue(ts, value - _offset, 1) >= 2 ? 1 : 0;
 }
 
 inline signed char AllDifferent::decreaseCount(Timestamp ts, Int value) {
   if (value < _offset || static_cast<Int>(_counts.size()) <= value - _offset) {
     return 0;
   }
-  assert(_counts[value - _offset].value(ts) - 1 >= 0);
-  assert(_counts[value - _offset].value(ts) - 1 <=
+  assert(_counts.value(ts, value - _offset) - 1 >= 0);
+  assert(_counts.value(ts, value - _offset) - 1 <=
          static_cast<Int>(_vars.size()));
-  return _counts[value - _offset].incValue(ts, -1) >= 1 ? -1 : 0;
+  return _counts.incValue(ts, value - _offset, -1) >= 1 ? -1 : 0;
 }
 
 }  // namespace atlantis::propagation
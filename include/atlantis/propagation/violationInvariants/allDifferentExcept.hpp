@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/solverBase.hpp"
@@ -27,6 +28,7 @@ class AllDifferentExcept : public AllDifferent {
 
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
 };
 
 inline bool AllDifferentExcept::isIgnored(const Int val) const {
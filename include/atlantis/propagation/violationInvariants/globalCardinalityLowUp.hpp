@@ -2,11 +2,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/variables/committableIntVector.hpp"
 #include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
 #include "atlantis/types.hpp"
 
@@ -19,7 +20,7 @@ class GlobalCardinalityLowUp : public ViolationInvariant {
   std::vector<Int> _upperBounds;
   CommittableInt _shortage;
   CommittableInt _excess;
-  std::vector<CommittableInt> _counts;
+  CommittableIntVector _counts;
   Int _offset;
   signed char increaseCount(Timestamp ts, Int value);
   signed char decreaseCount(Timestamp ts, Int value);
@@ -52,6 +53,8 @@ class GlobalCardinalityLowUp : public ViolationInvariant {
   void close(Timestamp) override;
   void recompute(Timestamp) override;
   void notifyInputChanged(Timestamp, LocalId) override;
+  void notifyInputsChanged(Timestamp, std::span<const LocalId>) override;
+  [[nodiscard]] bool batchesInputChanges() const override { return true; }
   void commit(Timestamp) override;
   VarViewId nextInput(Timestamp) override;
   void notifyCurrentInputChanged(Timestamp) override;
@@ -64,7 +67,7 @@ inline signed char GlobalCardinalityLowUp::increaseCount(Timestamp ts,
   if (_lowerBounds.at(pos) < 0) {
     return 0;
   }
-  Int newCount = _counts.at(pos).incValue(ts, 1);
+  Int newCount = _counts.incValue(ts, pos, 1);
   assert(newCount >= 0);
   assert(newCount <= static_cast<Int>(_vars.size()));
   return newCount > _upperBounds.at(pos)
@@ -80,7 +83,7 @@ inline signed char GlobalCardinalityLowUp::decreaseCount(Timestamp ts,
     return 0;
   }
 
-  Int newCount = _counts.at(pos).incValue(ts, -1);
+  Int newCount = _counts.incValue(ts, pos, -1);
   assert(newCount >= 0);
   assert(newCount <= static_cast<Int>(_vars.size()));
   return newCount < _lowerBounds.at(pos)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "atlantis/search/annealing/annealingSchedule.hpp"
 #include "atlantis/search/cost.hpp"
 #include "atlantis/search/move.hpp"
@@ -28,6 +30,10 @@ class Annealer {
   UInt _violationWeight{1};
   UInt _objectiveWeight{1};
 
+  // The largest cost of a move that is accepted, drawn before the move is
+  // probed:
+  Int _maxAcceptableCost{0};
+
  public:
   Annealer(const Assignment& assignment, RandomProvider& random,
            AnnealingSchedule& schedule);
@@ -63,11 +69,20 @@ class Annealer {
    * @return True if @p move should be committed, false otherwise.
    */
   template <unsigned int N>
-  bool acceptMove(Move<N> move) {
+  bool acceptMove(Move<N>& move) {
     _attemptedMovesPerRound++;
 
-    Int moveCost = evaluate(move.probe(_assignment));
-    return accept(moveCost);
+    // The random threshold is drawn before probing, so that the probe can
+    // be cut off as soon as the move is known to be rejected:
+    _maxAcceptableCost = maxAcceptableCost();
+    const std::optional<Cost> cost =
+        move.probe(_assignment,
+                   _assignment.maxViolation(_maxAcceptableCost,
+                                            _violationWeight, _objectiveWeight));
+    if (!cost.has_value()) {
+      return reject();
+    }
+    return accept(evaluate(*cost));
   }
 
   [[nodiscard]] const RoundStatistics& currentRoundStatistics() {
@@ -75,8 +90,20 @@ class Annealer {
   }
 
  protected:
+  /**
+   * Draws the threshold of the Metropolis criterion: a move is accepted iff
+   * its cost is at most the returned value.
+   */
+  virtual Int maxAcceptableCost();
+
   virtual bool accept(Int moveCost);
 
+  /**
+   * Rejects a move that was cut off whilst being probed, which means that
+   * its cost exceeds the maximum acceptable cost.
+   */
+  bool reject();
+
   [[nodiscard]] inline Int evaluate(Cost cost) const {
     return cost.evaluate(_violationWeight, _objectiveWeight);
   }
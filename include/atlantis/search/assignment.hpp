@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "atlantis/propagation/solver.hpp"
@@ -8,6 +10,9 @@
 
 namespace atlantis::search {
 
+template <unsigned int N>
+class Move;
+
 class AssignmentModifier {
  private:
   propagation::Solver& _solver;
@@ -90,6 +95,74 @@ class Assignment {
             _objectiveDirection};
   }
 
+  /**
+   * Probe the cost of a modification to the assignment, but stop
+   * propagating as soon as the violation provably exceeds @p maxViolation.
+   *
+   * @param modificationFunc The callback which sets the variables to their
+   * new values for the probe.
+   * @param maxViolation The largest violation of interest.
+   * @return The cost of the assignment if the altered values were committed,
+   * or nothing if the probe was cut off.
+   */
+  template <typename Callback>
+  std::optional<Cost> probe(Callback modificationFunc,
+                            Int maxViolation) const {
+    move(modificationFunc);
+
+    _solver.beginProbe();
+    _solver.query(_objective);
+    _solver.query(_violation);
+    if (!_solver.endBoundedProbe(maxViolation)) {
+      return std::nullopt;
+    }
+
+    return Cost{_solver.currentValue(_violation),
+                _solver.currentValue(_objective), _objectiveDirection};
+  }
+
+  /**
+   * @return The largest violation a modification can have for its cost
+   * (given the weights) to be at most @p maxCost, assuming the best possible
+   * objective value.
+   */
+  [[nodiscard]] Int maxViolation(Int maxCost, UInt violationWeight,
+                                 UInt objectiveWeight) const noexcept;
+
+  /**
+   * Probe the costs of a batch of candidate moves in a single probe session
+   * of the solver. This is cheaper than probing the moves one by one, and
+   * the moves cache their costs just as if Move::probe had been called on
+   * each of them, in order. Moves that have already been probed are not
+   * probed again.
+   *
+   * Defined in move.hpp.
+   *
+   * @param moves The candidate moves to probe.
+   * @return The costs of the moves, in the same order as @p moves.
+   */
+  template <unsigned int N>
+  std::vector<Cost> probe(std::span<Move<N>> moves) const;
+
+  /**
+   * Commit the most recent probe in place, without propagating it again.
+   * This is only possible if the probe was performed at @p probeTimestamp
+   * and nothing has been probed or assigned since.
+   *
+   * @param probeTimestamp The timestamp at which the probe was performed.
+   * @return True if the probe was committed, false otherwise (in which case
+   * the assignment is unchanged).
+   */
+  bool commitProbe(propagation::Timestamp probeTimestamp);
+
+  /**
+   * @return The timestamp of the solver. After a probe, this is the
+   * timestamp at which the probe was performed.
+   */
+  [[nodiscard]] propagation::Timestamp currentTimestamp() const noexcept {
+    return _solver.currentTimestamp();
+  }
+
   /**
    * Get the value of a variable in the current assignment.
    *
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <optional>
+#include <vector>
+
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/search/assignment.hpp"
 #include "atlantis/search/cost.hpp"
@@ -27,6 +31,7 @@ class Move {
           modifier.set(_vars[i], _values[i]);
         }
       });
+      _probeTimestamp = assignment.currentTimestamp();
 
       _probed = true;
     }
@@ -35,11 +40,47 @@ class Move {
   }
 
   /**
-   * Commit this move on the given assignment.
+   * Probe the cost of this move on the given assignment, but stop as soon
+   * as the violation provably exceeds @p maxViolation. Will only probe the
+   * assignment once, unless the probe was cut off.
+   *
+   * @param assignment The assignment to probe on.
+   * @param maxViolation The largest violation of interest.
+   * @return The cost of the assignment if this move were committed, or
+   * nothing if the probe was cut off.
+   */
+  std::optional<Cost> probe(const Assignment& assignment, Int maxViolation) {
+    if (!_probed) {
+      const std::optional<Cost> cost = assignment.probe(
+          [&](auto& modifier) {
+            for (size_t i = 0; i < N; i++) {
+              modifier.set(_vars[i], _values[i]);
+            }
+          },
+          maxViolation);
+      if (!cost.has_value()) {
+        return std::nullopt;
+      }
+      _cost = *cost;
+      _probeTimestamp = assignment.currentTimestamp();
+
+      _probed = true;
+    }
+
+    return _cost;
+  }
+
+  /**
+   * Commit this move on the given assignment. If this move was the most
+   * recently probed one, then the probe is committed in place instead of
+   * being propagated again.
    *
    * @param assignment The assignment to change.
    */
   void commit(Assignment& assignment) {
+    if (_probed && assignment.commitProbe(_probeTimestamp)) {
+      return;
+    }
     assignment.assign([&](auto& modifier) {
       for (auto i = 0u; i < N; i++) {
         modifier.set(_vars[i], _values[i]);
@@ -48,11 +89,50 @@ class Move {
   }
 
  private:
+  friend class Assignment;
+
   std::array<propagation::VarViewId, N> _vars;
   std::array<Int, N> _values;
 
   Cost _cost{0, 0, propagation::ObjectiveDirection::NONE};
   bool _probed{false};
+  propagation::Timestamp _probeTimestamp{propagation::NULL_TIMESTAMP};
 };
 
+template <unsigned int N>
+std::vector<Cost> Assignment::probe(std::span<Move<N>> moves) const {
+  std::vector<Move<N>*> candidates;
+  candidates.reserve(moves.size());
+  for (Move<N>& move : moves) {
+    if (!move._probed) {
+      candidates.push_back(&move);
+    }
+  }
+
+  const std::array<propagation::VarViewId, 2> queries{_objective, _violation};
+  _solver.probeBatch(
+      queries, candidates.size(),
+      [&](size_t i) {
+        const Move<N>& move = *candidates[i];
+        for (size_t j = 0; j < N; ++j) {
+          _solver.setValue(move._vars[j], move._values[j]);
+        }
+      },
+      [&](size_t i) {
+        Move<N>& move = *candidates[i];
+        move._cost = Cost{_solver.currentValue(_violation),
+                          _solver.currentValue(_objective),
+                          _objectiveDirection};
+        move._probeTimestamp = _solver.currentTimestamp();
+        move._probed = true;
+      });
+
+  std::vector<Cost> costs;
+  costs.reserve(moves.size());
+  for (const Move<N>& move : moves) {
+    costs.push_back(move._cost);
+  }
+  return costs;
+}
+
 }  // namespace atlantis::search
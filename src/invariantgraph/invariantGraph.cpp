@@ -1174,6 +1174,14 @@ void InvariantGraph::construct() {
   breakCycles();
   sanity(true);
   _solver.open();
+  // Give the solver a hint of the size of the model, so that the invariants
+  // and views can be allocated contiguously:
+  const size_t numActiveInvariantNodes = static_cast<size_t>(std::count_if(
+      _invariantNodes.begin(), _invariantNodes.end(), [](const auto& node) {
+        return node->state() == InvariantNodeState::ACTIVE;
+      }));
+  _solver.reserve(_varNodes.size(), numActiveInvariantNodes,
+                  numActiveInvariantNodes);
   createVars();
   createImplicitConstraints();
   createInvariants();
@@ -5,6 +5,7 @@
 
 #include "../parseHelper.hpp"
 #include "atlantis/propagation/invariants/maxSparse.hpp"
+#include "atlantis/propagation/invariants/maxTournament.hpp"
 #include "atlantis/propagation/views/intMaxView.hpp"
 
 namespace atlantis::invariantgraph {
@@ -110,9 +111,15 @@ void ArrayIntMaximumNode::registerNode() {
   assert(invariantGraph().varId(outputVarNodeIds().front()) !=
          propagation::NULL_ID);
   assert(invariantGraph().varId(outputVarNodeIds().front()).isVar());
-  solver().makeInvariant<propagation::MaxSparse>(
-      solver(), invariantGraph().varId(outputVarNodeIds().front()),
-      std::move(solverVars));
+  if (solverVars.size() >= TOURNAMENT_MIN_ARITY) {
+    solver().makeInvariant<propagation::MaxTournament>(
+        solver(), invariantGraph().varId(outputVarNodeIds().front()),
+        std::move(solverVars));
+  } else {
+    solver().makeInvariant<propagation::MaxSparse>(
+        solver(), invariantGraph().varId(outputVarNodeIds().front()),
+        std::move(solverVars));
+  }
 }
 
 }  // namespace atlantis::invariantgraph
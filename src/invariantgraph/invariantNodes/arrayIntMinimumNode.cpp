@@ -5,6 +5,7 @@
 
 #include "../parseHelper.hpp"
 #include "atlantis/propagation/invariants/minSparse.hpp"
+#include "atlantis/propagation/invariants/minTournament.hpp"
 #include "atlantis/propagation/views/intMinView.hpp"
 
 namespace atlantis::invariantgraph {
@@ -110,9 +111,15 @@ void ArrayIntMinimumNode::registerNode() {
   assert(invariantGraph().varId(outputVarNodeIds().front()) !=
          propagation::NULL_ID);
   assert(invariantGraph().varId(outputVarNodeIds().front()).isVar());
-  solver().makeInvariant<propagation::MinSparse>(
-      solver(), invariantGraph().varId(outputVarNodeIds().front()),
-      std::move(solverVars));
+  if (solverVars.size() >= TOURNAMENT_MIN_ARITY) {
+    solver().makeInvariant<propagation::MinTournament>(
+        solver(), invariantGraph().varId(outputVarNodeIds().front()),
+        std::move(solverVars));
+  } else {
+    solver().makeInvariant<propagation::MinSparse>(
+        solver(), invariantGraph().varId(outputVarNodeIds().front()),
+        std::move(solverVars));
+  }
 }
 
 }  // namespace atlantis::invariantgraph
@@ -1,8 +1,12 @@
 #include "atlantis/propagation/invariants/boolLinear.hpp"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 #include <vector>
 
+#include "atlantis/propagation/utils/kernels.hpp"
+
 namespace atlantis::propagation {
 
 BoolLinear::BoolLinear(SolverBase& solver, VarId output,
@@ -11,7 +15,9 @@ BoolLinear::BoolLinear(SolverBase& solver, VarId output,
     : Invariant(solver),
       _output(output),
       _coeffs(std::move(coeffs)),
-      _violArray(std::move(violArray)) {}
+      _violArray(std::move(violArray)),
+      _inputsAreVars(std::all_of(_violArray.begin(), _violArray.end(),
+                                 [](VarViewId id) { return id.isVar(); })) {}
 
 BoolLinear::BoolLinear(SolverBase& solver, VarViewId output,
                        std::vector<Int>&& coeffs,
@@ -68,8 +74,22 @@ void BoolLinear::updateBounds(bool widenOnly) {
 
 void BoolLinear::recompute(Timestamp ts) {
   Int sum = 0;
-  for (size_t i = 0; i < _violArray.size(); ++i) {
-    sum += _coeffs[i] * static_cast<Int>(_solver.value(ts, _violArray[i]) == 0);
+  if (_inputsAreVars) {
+    std::array<Int, kernels::CHUNK_SIZE> values;
+    const std::span<const Int> coeffs(_coeffs);
+    const std::span<const VarViewId> vars(_violArray);
+    for (size_t i = 0; i < vars.size(); i += kernels::CHUNK_SIZE) {
+      const size_t size = std::min(kernels::CHUNK_SIZE, vars.size() - i);
+      _solver.gatherValues(ts, vars.subspan(i, size), values);
+      sum += kernels::sumWhereEqual(coeffs.subspan(i, size),
+                                    std::span<const Int>(values).first(size),
+                                    0);
+    }
+  } else {
+    for (size_t i = 0; i < _violArray.size(); ++i) {
+      sum +=
+          _coeffs[i] * static_cast<Int>(_solver.value(ts, _violArray[i]) == 0);
+    }
   }
   updateValue(ts, _output, sum);
 }
@@ -1,8 +1,12 @@
 #include "atlantis/propagation/invariants/count.hpp"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <utility>
 
+#include "atlantis/propagation/utils/kernels.hpp"
+
 namespace atlantis::propagation {
 
 Count::Count(SolverBase& solver, VarId output, VarViewId needle,
@@ -11,6 +15,8 @@ Count::Count(SolverBase& solver, VarId output, VarViewId needle,
       _output(output),
       _needle(needle),
       _vars(std::move(varArray)),
+      _inputsAreVars(std::all_of(_vars.begin(), _vars.end(),
+                                 [](VarViewId id) { return id.isVar(); })),
       _counts(),
       _offset(0) {}
 
@@ -45,20 +51,31 @@ void Count::close(Timestamp ts) {
   lb = std::max(lb, _solver.lowerBound(_needle));
   ub = std::max(ub, _solver.lowerBound(_needle));
 
-  _counts.resize(static_cast<unsigned long>(ub - lb + 1),
-                 CommittableInt(ts, 0));
+  _counts.resize(ts, static_cast<unsigned long>(ub - lb + 1), 0);
   _offset = lb;
 }
 
 void Count::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
+  for (size_t i = 0; i < _counts.size(); ++i) {
+    _counts.setValue(ts, i, 0);
   }
 
   updateValue(ts, _output, 0);
 
-  for (const auto& var : _vars) {
-    increaseCount(ts, _solver.value(ts, var));
+  if (_inputsAreVars) {
+    std::array<Int, kernels::CHUNK_SIZE> values;
+    const std::span<const VarViewId> vars(_vars);
+    for (size_t i = 0; i < vars.size(); i += kernels::CHUNK_SIZE) {
+      const size_t size = std::min(kernels::CHUNK_SIZE, vars.size() - i);
+      _solver.gatherValues(ts, vars.subspan(i, size), values);
+      for (size_t j = 0; j < size; ++j) {
+        increaseCount(ts, values[j]);
+      }
+    }
+  } else {
+    for (const auto& var : _vars) {
+      increaseCount(ts, _solver.value(ts, var));
+    }
   }
   updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
 }
@@ -79,6 +96,23 @@ void Count::notifyInputChanged(Timestamp ts, LocalId id) {
   updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
 }
 
+void Count::notifyInputsChanged(Timestamp ts,
+                                std::span<const LocalId> localIds) {
+  for (const LocalId id : localIds) {
+    if (id == _vars.size()) {
+      continue;
+    }
+    assert(id < _vars.size());
+    const Int newValue = _solver.value(ts, _vars[id]);
+    const Int committedValue = _solver.committedValue(_vars[id]);
+    if (newValue != committedValue) {
+      decreaseCount(ts, committedValue);
+      increaseCount(ts, newValue);
+    }
+  }
+  updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
+}
+
 VarViewId Count::nextInput(Timestamp ts) {
   const auto index = static_cast<size_t>(_state.incValue(ts, 1));
   if (index < _vars.size()) {
@@ -97,8 +131,6 @@ void Count::notifyCurrentInputChanged(Timestamp ts) {
 void Count::commit(Timestamp ts) {
   Invariant::commit(ts);
 
-  for (CommittableInt& committableInt : _counts) {
-    committableInt.commitIf(ts);
-  }
+  _counts.commitIf(ts);
 }
 }  // namespace atlantis::propagation
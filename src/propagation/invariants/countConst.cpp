@@ -1,8 +1,12 @@
 #include "atlantis/propagation/invariants/countConst.hpp"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 #include <vector>
 
+#include "atlantis/propagation/utils/kernels.hpp"
+
 namespace atlantis::propagation {
 
 CountConst::CountConst(SolverBase& solver, VarId output, Int needle,
@@ -10,7 +14,9 @@ CountConst::CountConst(SolverBase& solver, VarId output, Int needle,
     : Invariant(solver),
       _output(output),
       _needle(needle),
-      _vars(std::move(vars)) {}
+      _vars(std::move(vars)),
+      _inputsAreVars(std::all_of(_vars.begin(), _vars.end(),
+                                 [](VarViewId id) { return id.isVar(); })) {}
 
 CountConst::CountConst(SolverBase& solver, VarViewId output, Int needle,
                        std::vector<VarViewId>&& vars)
@@ -35,8 +41,19 @@ void CountConst::updateBounds(bool widenOnly) {
 
 void CountConst::recompute(Timestamp ts) {
   Int count = 0;
-  for (const auto& var : _vars) {
-    count += static_cast<Int>(_solver.value(ts, var) == _needle);
+  if (_inputsAreVars) {
+    std::array<Int, kernels::CHUNK_SIZE> values;
+    const std::span<const VarViewId> vars(_vars);
+    for (size_t i = 0; i < vars.size(); i += kernels::CHUNK_SIZE) {
+      const size_t size = std::min(kernels::CHUNK_SIZE, vars.size() - i);
+      _solver.gatherValues(ts, vars.subspan(i, size), values);
+      count += kernels::countEqual(std::span<const Int>(values).first(size),
+                                   _needle);
+    }
+  } else {
+    for (const auto& var : _vars) {
+      count += static_cast<Int>(_solver.value(ts, var) == _needle);
+    }
   }
   updateValue(ts, _output, count);
 }
@@ -53,6 +70,19 @@ void CountConst::notifyInputChanged(Timestamp ts, LocalId id) {
   incValue(ts, _output, newValue - committedValue);
 }
 
+void CountConst::notifyInputsChanged(Timestamp ts,
+                                     std::span<const LocalId> localIds) {
+  Int delta = 0;
+  for (const LocalId id : localIds) {
+    assert(id < _vars.size());
+    delta += static_cast<Int>(_solver.value(ts, _vars[id]) == _needle) -
+             static_cast<Int>(_solver.committedValue(_vars[id]) == _needle);
+  }
+  if (delta != 0) {
+    incValue(ts, _output, delta);
+  }
+}
+
 VarViewId CountConst::nextInput(Timestamp ts) {
   const auto index = static_cast<size_t>(_state.incValue(ts, 1));
   assert(0 <= _state.value(ts));
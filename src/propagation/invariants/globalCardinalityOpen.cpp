@@ -82,12 +82,12 @@ void GlobalCardinalityOpen::close(Timestamp timestamp) {
     assert(_cover[i] - _offset < static_cast<Int>(_coverVarIndex.size()));
     _coverVarIndex[_cover[i] - _offset] = i;
   }
-  _counts.resize(_outputs.size(), CommittableInt(timestamp, 0));
+  _counts.resize(timestamp, _outputs.size(), 0);
 }
 
 void GlobalCardinalityOpen::recompute(Timestamp timestamp) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(timestamp, 0);
+  for (size_t i = 0; i < _counts.size(); ++i) {
+    _counts.setValue(timestamp, i, 0);
   }
 
   for (const auto& var : _inputs) {
@@ -97,7 +97,7 @@ void GlobalCardinalityOpen::recompute(Timestamp timestamp) {
   for (size_t i = 0; i < _outputs.size(); ++i) {
     assert(0 <= _cover[i] - _offset &&
            _cover[i] - _offset < static_cast<Int>(_coverVarIndex.size()));
-    updateValue(timestamp, _outputs[i], _counts[i].value(timestamp));
+    updateValue(timestamp, _outputs[i], _counts.value(timestamp, i));
   }
 }
 
@@ -130,8 +130,6 @@ void GlobalCardinalityOpen::notifyCurrentInputChanged(Timestamp timestamp) {
 void GlobalCardinalityOpen::commit(Timestamp timestamp) {
   Invariant::commit(timestamp);
 
-  for (CommittableInt& CommittableInt : _counts) {
-    CommittableInt.commitIf(timestamp);
-  }
+  _counts.commitIf(timestamp);
 }
 }  // namespace atlantis::propagation
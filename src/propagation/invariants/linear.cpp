@@ -1,7 +1,11 @@
 #include "atlantis/propagation/invariants/linear.hpp"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 
+#include "atlantis/propagation/utils/kernels.hpp"
+
 namespace atlantis::propagation {
 
 Linear::Linear(SolverBase& solver, VarId output, std::vector<Int>&& coeffs,
@@ -9,7 +13,9 @@ Linear::Linear(SolverBase& solver, VarId output, std::vector<Int>&& coeffs,
     : Invariant(solver),
       _output(output),
       _coeffs(std::move(coeffs)),
-      _varArray(std::move(varArray)) {}
+      _varArray(std::move(varArray)),
+      _inputsAreVars(std::all_of(_varArray.begin(), _varArray.end(),
+                                 [](VarViewId id) { return id.isVar(); })) {}
 
 Linear::Linear(SolverBase& solver, VarViewId output, std::vector<Int>&& coeffs,
                std::vector<VarViewId>&& varArray)
@@ -55,8 +61,20 @@ void Linear::updateBounds(bool widenOnly) {
 
 void Linear::recompute(Timestamp ts) {
   Int sum = 0;
-  for (size_t i = 0; i < _varArray.size(); ++i) {
-    sum += _coeffs[i] * _solver.value(ts, _varArray[i]);
+  if (_inputsAreVars) {
+    std::array<Int, kernels::CHUNK_SIZE> values;
+    const std::span<const Int> coeffs(_coeffs);
+    const std::span<const VarViewId> vars(_varArray);
+    for (size_t i = 0; i < vars.size(); i += kernels::CHUNK_SIZE) {
+      const size_t size = std::min(kernels::CHUNK_SIZE, vars.size() - i);
+      _solver.gatherValues(ts, vars.subspan(i, size), values);
+      sum += kernels::dotProduct(coeffs.subspan(i, size),
+                                 std::span<const Int>(values).first(size));
+    }
+  } else {
+    for (size_t i = 0; i < _varArray.size(); ++i) {
+      sum += _coeffs[i] * _solver.value(ts, _varArray[i]);
+    }
   }
   updateValue(ts, _output, sum);
 }
@@ -69,6 +87,18 @@ void Linear::notifyInputChanged(Timestamp ts, LocalId id) {
                _coeffs[id]);
 }
 
+void Linear::notifyInputsChanged(Timestamp ts,
+                                 std::span<const LocalId> localIds) {
+  Int delta = 0;
+  for (const LocalId id : localIds) {
+    assert(id < _varArray.size());
+    delta += (_solver.value(ts, _varArray[id]) -
+              _solver.committedValue(_varArray[id])) *
+             _coeffs[id];
+  }
+  incValue(ts, _output, delta);
+}
+
 VarViewId Linear::nextInput(Timestamp ts) {
   const auto index = static_cast<size_t>(_state.incValue(ts, 1));
   assert(0 <= _state.value(ts));
@@ -83,4 +113,12 @@ void Linear::notifyCurrentInputChanged(Timestamp ts) {
   notifyInputChanged(ts, _state.value(ts));
 }
 
+bool Linear::linearTerms(
+    std::vector<std::pair<VarViewId, Int>>& terms) const {
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    terms.emplace_back(_varArray[i], _coeffs[i]);
+  }
+  return true;
+}
+
 }  // namespace atlantis::propagation
@@ -0,0 +1,70 @@
+#include "atlantis/propagation/invariants/maxTournament.hpp"
+
+#include <limits>
+
+namespace atlantis::propagation {
+
+MaxTournament::MaxTournament(SolverBase& solver, VarId output,
+                             std::vector<VarViewId>&& varArray)
+    : Invariant(solver),
+      _output(output),
+      _varArray(std::move(varArray)),
+      _localPriority(_varArray.size()) {
+  assert(!_varArray.empty());
+}
+
+MaxTournament::MaxTournament(SolverBase& solver, VarViewId output,
+                             std::vector<VarViewId>&& varArray)
+    : MaxTournament(solver, VarId(output), std::move(varArray)) {
+  assert(output.isVar());
+}
+
+void MaxTournament::registerVars() {
+  assert(_id != NULL_ID);
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    _solver.registerInvariantInput(_id, _varArray[i], i, false);
+  }
+  registerDefinedVar(_output);
+}
+
+void MaxTournament::updateBounds(bool widenOnly) {
+  Int lb = std::numeric_limits<Int>::min();
+  Int ub = std::numeric_limits<Int>::min();
+  for (const VarViewId& input : _varArray) {
+    lb = std::max(lb, _solver.lowerBound(input));
+    ub = std::max(ub, _solver.upperBound(input));
+  }
+  _solver.updateBounds(_output, lb, ub, widenOnly);
+}
+
+void MaxTournament::recompute(Timestamp ts) {
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    _localPriority.updatePriority(ts, i, _solver.value(ts, _varArray[i]));
+  }
+  updateValue(ts, _output, _localPriority.top(ts));
+}
+
+void MaxTournament::notifyInputChanged(Timestamp ts, LocalId id) {
+  _localPriority.updatePriority(ts, id, _solver.value(ts, _varArray[id]));
+  updateValue(ts, _output, _localPriority.top(ts));
+}
+
+VarViewId MaxTournament::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  assert(0 <= _state.value(ts));
+  if (index < _varArray.size()) {
+    return _varArray[index];
+  } else {
+    return NULL_ID;  // Done
+  }
+}
+
+void MaxTournament::notifyCurrentInputChanged(Timestamp ts) {
+  notifyInputChanged(ts, _state.value(ts));
+}
+
+void MaxTournament::commit(Timestamp ts) {
+  Invariant::commit(ts);
+  _localPriority.commitIf(ts);
+}
+}  // namespace atlantis::propagation
@@ -0,0 +1,71 @@
+#include "atlantis/propagation/invariants/minTournament.hpp"
+
+#include <limits>
+#include <utility>
+
+namespace atlantis::propagation {
+
+MinTournament::MinTournament(SolverBase& solver, VarId output,
+                             std::vector<VarViewId>&& varArray)
+    : Invariant(solver),
+      _output(output),
+      _varArray(std::move(varArray)),
+      _localPriority(_varArray.size()) {
+  assert(!_varArray.empty());
+}
+
+MinTournament::MinTournament(SolverBase& solver, VarViewId output,
+                             std::vector<VarViewId>&& varArray)
+    : MinTournament(solver, VarId(output), std::move(varArray)) {
+  assert(output.isVar());
+}
+
+void MinTournament::registerVars() {
+  assert(_id != NULL_ID);
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    _solver.registerInvariantInput(_id, _varArray[i], i, false);
+  }
+  registerDefinedVar(_output);
+}
+
+void MinTournament::updateBounds(bool widenOnly) {
+  Int lb = std::numeric_limits<Int>::max();
+  Int ub = std::numeric_limits<Int>::max();
+  for (const VarViewId& input : _varArray) {
+    lb = std::min(lb, _solver.lowerBound(input));
+    ub = std::min(ub, _solver.upperBound(input));
+  }
+  _solver.updateBounds(_output, lb, ub, widenOnly);
+}
+
+void MinTournament::recompute(Timestamp ts) {
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    _localPriority.updatePriority(ts, i, _solver.value(ts, _varArray[i]));
+  }
+  updateValue(ts, _output, _localPriority.top(ts));
+}
+
+void MinTournament::notifyInputChanged(Timestamp ts, LocalId id) {
+  _localPriority.updatePriority(ts, id, _solver.value(ts, _varArray[id]));
+  updateValue(ts, _output, _localPriority.top(ts));
+}
+
+VarViewId MinTournament::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  assert(0 <= _state.value(ts));
+  if (index < _varArray.size()) {
+    return _varArray[index];
+  } else {
+    return NULL_ID;  // Done
+  }
+}
+
+void MinTournament::notifyCurrentInputChanged(Timestamp ts) {
+  notifyInputChanged(ts, _state.value(ts));
+}
+
+void MinTournament::commit(Timestamp ts) {
+  Invariant::commit(ts);
+  _localPriority.commitIf(ts);
+}
+}  // namespace atlantis::propagation
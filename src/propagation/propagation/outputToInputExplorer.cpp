@@ -15,69 +15,121 @@ OutputToInputExplorer::OutputToInputExplorer(Solver& e, size_t expectedSize)
       _invariantComputedAt(),
       _invariantIsOnStack(),
       _searchVarAncestors(),
-      _onPropagationPath(),
+      _onPropagationPathAt(),
       _outputToInputMarkingMode(OutputToInputMarkingMode::NONE) {
   _varStack.reserve(expectedSize);
   _invariantStack.reserve(expectedSize);
   _varComputedAt.reserve(expectedSize);
   _invariantComputedAt.reserve(expectedSize);
   _invariantIsOnStack.reserve(expectedSize);
-  _searchVarAncestors.reserve(expectedSize);
-  _onPropagationPath.reserve(expectedSize);
+  _onPropagationPathAt.reserve(expectedSize);
 }
 
-void OutputToInputExplorer::outputToInputStaticMarking() {
-  std::vector<bool> varVisited(_solver.numVars());
-
-  for (size_t idx = 0;
-       idx < std::min(_searchVarAncestors.size(), _solver.numVars()); ++idx) {
-    _searchVarAncestors[idx].clear();
+std::vector<size_t> OutputToInputExplorer::renumberSearchVars() {
+  // Number the search variables in the order they are reached by a
+  // depth-first search from the evaluation variables towards the search
+  // variables. The search variables that share descendants are thereby
+  // numbered (close to) consecutively, which keeps the ancestor sets dense.
+  std::vector<size_t> searchVarIndex(_solver.numVars(),
+                                     SearchVarAncestors::NOT_A_SEARCH_VAR);
+  std::vector<bool> varVisited(_solver.numVars(), false);
+  std::vector<VarId> stack;
+  size_t numSearchVars = 0;
+  const auto visit = [&](VarId root) {
+    if (varVisited[root]) {
+      return;
+    }
+    varVisited[root] = true;
+    stack.emplace_back(root);
+    while (!stack.empty()) {
+      const VarId id = stack.back();
+      stack.pop_back();
+      const InvariantId invariantId = _solver.definingInvariant(id);
+      if (invariantId == NULL_ID) {
+        searchVarIndex[id] = numSearchVars++;
+        continue;
+      }
+      // Push the inputs in reverse, so that they are visited in order:
+      const auto inputs = _solver.inputVars(invariantId);
+      for (auto it = inputs.rbegin(); it != inputs.rend(); ++it) {
+        if (!varVisited[it->first]) {
+          varVisited[it->first] = true;
+          stack.emplace_back(it->first);
+        }
+      }
+    }
+  };
+  for (const VarId id : _solver.evaluationVars()) {
+    visit(id);
   }
+  for (const VarId id : _solver.searchVars()) {
+    visit(id);
+  }
+  assert(numSearchVars == _solver.searchVars().size());
+  return searchVarIndex;
+}
 
-  _searchVarAncestors.resize(_solver.numVars());
-  assert(std::all_of(
-      _searchVarAncestors.begin(), _searchVarAncestors.end(),
-      [&](const std::unordered_set<VarId> anc) { return anc.empty(); }));
+void OutputToInputExplorer::outputToInputStaticMarking() {
+  std::vector<size_t> searchVarIndex = renumberSearchVars();
+  std::vector<VarId> searchVars(_solver.searchVars().size(), NULL_ID);
+  for (const VarId id : _solver.searchVars()) {
+    searchVars[searchVarIndex[id]] = id;
+  }
 
-  for (const VarId searchVar : _solver.searchVars()) {
-    std::fill(varVisited.begin(), varVisited.end(), false);
-    std::vector<VarId> stack;
-    stack.reserve(_solver.numVars());
+  // The search variables are visited in increasing order of their index,
+  // so the blocks of each set are appended in sorted order:
+  std::vector<std::vector<SearchVarAncestors::Block>> ancestors(
+      _solver.numVars());
+  // The (index + 1) of the search variable that visited a variable last:
+  std::vector<size_t> visitedBy(_solver.numVars(), 0);
+  std::vector<VarId> stack;
 
-    stack.emplace_back(searchVar);
-    varVisited[searchVar] = true;
+  for (size_t index = 0; index < searchVars.size(); ++index) {
+    const size_t blockIndex = index / SearchVarAncestors::BLOCK_SIZE;
+    const uint64_t bit = uint64_t(1)
+                         << (index % SearchVarAncestors::BLOCK_SIZE);
+    stack.emplace_back(searchVars[index]);
+    visitedBy[searchVars[index]] = index + 1;
 
     while (!stack.empty()) {
       const VarId id = stack.back();
       stack.pop_back();
-      _searchVarAncestors[id].emplace(searchVar);
+      std::vector<SearchVarAncestors::Block>& blocks = ancestors[id];
+      if (blocks.empty() || blocks.back().index != blockIndex) {
+        blocks.emplace_back(SearchVarAncestors::Block{blockIndex, bit});
+      } else {
+        blocks.back().bits |= bit;
+      }
 
       for (const PropagationGraph::ListeningInvariantData& invariantData :
            _solver.listeningInvariantData(id)) {
         for (const VarId outputVar :
              _solver.varsDefinedBy(invariantData.invariantId)) {
-          if (!varVisited[outputVar]) {
-            varVisited[outputVar] = true;
-            stack.push_back(outputVar);
+          if (visitedBy[outputVar] != index + 1) {
+            visitedBy[outputVar] = index + 1;
+            stack.emplace_back(outputVar);
           }
         }
       }
     }
   }
+  _searchVarAncestors.assign(std::move(searchVarIndex), ancestors);
 }
 
-void OutputToInputExplorer::inputToOutputExplorationMarking() {
+void OutputToInputExplorer::inputToOutputExplorationMarking(Timestamp ts) {
+  // The marks are stamped with the current timestamp, so only the variables
+  // on the propagation path are visited (the marks of previous timestamps
+  // are implicitly cleared):
+  assert(_onPropagationPathAt.size() == _solver.numVars());
   std::vector<VarId> stack;
-  stack.reserve(_solver.numVars());
-
-  _onPropagationPath.assign(_solver.numVars(), false);
 
   for (const VarId modifiedDecisionVar : _solver.modifiedSearchVar()) {
-    assert(modifiedDecisionVar < _onPropagationPath.size());
-    assert(!_onPropagationPath.at(modifiedDecisionVar));
+    if (isOnPropagationPath(ts, modifiedDecisionVar)) {
+      continue;
+    }
 
     stack.emplace_back(modifiedDecisionVar);
-    _onPropagationPath[modifiedDecisionVar] = true;
+    _onPropagationPathAt[modifiedDecisionVar] = ts;
 
     while (!stack.empty()) {
       const VarId id = stack.back();
@@ -86,9 +138,8 @@ void OutputToInputExplorer::inputToOutputExplorationMarking() {
            _solver.listeningInvariantData(id)) {
         for (const VarId outputVar :
              _solver.varsDefinedBy(invariantData.invariantId)) {
-          assert(outputVar < _onPropagationPath.size());
-          if (!_onPropagationPath[outputVar]) {
-            _onPropagationPath[outputVar] = true;
+          if (!isOnPropagationPath(ts, outputVar)) {
+            _onPropagationPathAt[outputVar] = ts;
             stack.emplace_back(outputVar);
           }
         }
@@ -110,7 +161,9 @@ void OutputToInputExplorer::close() {
   }
   if constexpr (MarkingMode !=
                 OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
-    _onPropagationPath.clear();
+    _onPropagationPathAt.clear();
+  } else {
+    _onPropagationPathAt.assign(_solver.numVars(), NULL_TIMESTAMP);
   }
   if constexpr (MarkingMode ==
                 OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
@@ -123,33 +176,35 @@ void OutputToInputExplorer::propagate(Timestamp ts) {
     propagate<OutputToInputMarkingMode::NONE>(ts);
   } else if (_outputToInputMarkingMode ==
              OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
-    inputToOutputExplorationMarking();
+    inputToOutputExplorationMarking(ts);
     propagate<OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(ts);
   } else if (_outputToInputMarkingMode ==
              OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
+    _searchVarAncestors.setModified(_solver.modifiedSearchVar());
     propagate<OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(ts);
   }
 }
 
+size_t OutputToInputExplorer::markingMemoryUsage() const noexcept {
+  return _searchVarAncestors.memoryUsage() +
+         _onPropagationPathAt.capacity() * sizeof(Timestamp);
+}
+
 template bool OutputToInputExplorer::isMarked<OutputToInputMarkingMode::NONE>(
-    VarId id);
+    Timestamp ts, VarId id);
 template bool OutputToInputExplorer::isMarked<
-    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(VarId id);
+    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(Timestamp ts, VarId id);
 template bool OutputToInputExplorer::isMarked<
-    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(VarId id);
+    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(Timestamp ts,
+                                                           VarId id);
 template <OutputToInputMarkingMode MarkingMode>
-bool OutputToInputExplorer::isMarked(VarId id) {
+bool OutputToInputExplorer::isMarked(Timestamp ts, VarId id) {
   if constexpr (MarkingMode ==
                 OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
-    assert(id < _searchVarAncestors.size());
-    return std::any_of(_solver.modifiedSearchVar().begin(),
-                       _solver.modifiedSearchVar().end(), [&](size_t ancestor) {
-                         return _searchVarAncestors[id].contains(ancestor);
-                       });
+    return _searchVarAncestors.hasModifiedAncestor(id);
   } else if constexpr (MarkingMode ==
                        OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
-    assert(id < _onPropagationPath.size());
-    return _onPropagationPath[id];
+    return isOnPropagationPath(ts, id);
   } else {
     // We should check this with constant expressions
     assert(false);
@@ -176,7 +231,7 @@ void OutputToInputExplorer::preprocessVarStack(Timestamp currentTimestamp) {
       _varStack[newStackSize] = _varStack[s];
       ++newStackSize;
     } else {
-      if (isMarked<MarkingMode>(_varStack[s])) {
+      if (isMarked<MarkingMode>(currentTimestamp, _varStack[s])) {
         _varStack[newStackSize] = _varStack[s];
         ++newStackSize;
       } else {
@@ -188,15 +243,17 @@ void OutputToInputExplorer::preprocessVarStack(Timestamp currentTimestamp) {
 }
 
 template void OutputToInputExplorer::expandInvariant<
-    OutputToInputMarkingMode::NONE>(InvariantId);
+    OutputToInputMarkingMode::NONE>(Timestamp, InvariantId);
 template void OutputToInputExplorer::expandInvariant<
-    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(InvariantId);
+    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(Timestamp, InvariantId);
 template void OutputToInputExplorer::expandInvariant<
-    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(InvariantId);
+    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(Timestamp,
+                                                           InvariantId);
 // We expand an invariant by pushing it and its first input variable onto each
 // stack.
 template <OutputToInputMarkingMode MarkingMode>
-void OutputToInputExplorer::expandInvariant(InvariantId invariantId) {
+void OutputToInputExplorer::expandInvariant(Timestamp ts,
+                                            InvariantId invariantId) {
   if (invariantId == NULL_ID) {
     return;
   }
@@ -207,7 +264,7 @@ void OutputToInputExplorer::expandInvariant(InvariantId invariantId) {
   // nextInput gets the source if the input would be a view:
   VarId nextVar = _solver.nextInput(invariantId);
   if constexpr (MarkingMode != OutputToInputMarkingMode::NONE) {
-    while (nextVar != NULL_ID && !isMarked<MarkingMode>(nextVar)) {
+    while (nextVar != NULL_ID && !isMarked<MarkingMode>(ts, nextVar)) {
       nextVar = _solver.nextInput(invariantId);
     }
   }
@@ -222,18 +279,18 @@ void OutputToInputExplorer::notifyCurrentInvariant() {
   _solver.notifyCurrentInputChanged(peekInvariantStack());
 }
 
-template bool
-OutputToInputExplorer::pushNextInputVar<OutputToInputMarkingMode::NONE>();
 template bool OutputToInputExplorer::pushNextInputVar<
-    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>();
+    OutputToInputMarkingMode::NONE>(Timestamp);
 template bool OutputToInputExplorer::pushNextInputVar<
-    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>();
+    OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC>(Timestamp);
+template bool OutputToInputExplorer::pushNextInputVar<
+    OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(Timestamp);
 
 template <OutputToInputMarkingMode MarkingMode>
-bool OutputToInputExplorer::pushNextInputVar() {
+bool OutputToInputExplorer::pushNextInputVar(Timestamp ts) {
   VarId nextVar = _solver.nextInput(peekInvariantStack());
   if constexpr (MarkingMode != OutputToInputMarkingMode::NONE) {
-    while (nextVar != NULL_ID && !isMarked<MarkingMode>(nextVar)) {
+    while (nextVar != NULL_ID && !isMarked<MarkingMode>(ts, nextVar)) {
       nextVar = _solver.nextInput(peekInvariantStack());
     }
   }
@@ -283,7 +340,8 @@ void OutputToInputExplorer::propagate(Timestamp currentTimestamp) {
       // results in an infinite loop.
       setComputed(currentTimestamp, currentVarId);
       // The variable is marked and computed: expand its defining invariant.
-      expandInvariant<MarkingMode>(_solver.definingInvariant(currentVarId));
+      expandInvariant<MarkingMode>(currentTimestamp,
+                                   _solver.definingInvariant(currentVarId));
       continue;
     }
     // currentVarId is done: pop it from the stack.
@@ -300,7 +358,7 @@ void OutputToInputExplorer::propagate(Timestamp currentTimestamp) {
     }
     // push the next input variable of the top invariant
     // returns false if there are no more variables to push
-    if (pushNextInputVar<MarkingMode>()) {
+    if (pushNextInputVar<MarkingMode>(currentTimestamp)) {
       // The top invariant has finished propagating, so all defined vars can
       // be marked as compte at the current time.
       for (const VarId defVar : _solver.varsDefinedBy(peekInvariantStack())) {
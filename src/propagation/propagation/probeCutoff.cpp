@@ -0,0 +1,96 @@
+#include "atlantis/propagation/propagation/probeCutoff.hpp"
+
+#include <algorithm>
+
+#include "atlantis/propagation/solverBase.hpp"
+
+namespace atlantis::propagation {
+
+ProbeCutoff::ProbeCutoff(SolverBase& solver) : _solver(solver) {}
+
+void ProbeCutoff::clear() {
+  _var = NULL_ID;
+  _terms.clear();
+  _sources.clear();
+  _termLevels.clear();
+  _coeffs.clear();
+  _minTermValues.clear();
+  _committedSlack.clear();
+  _totalSlack = 0;
+  _levelPositions.clear();
+  _levelSlack.clear();
+  _termsEnd.clear();
+  _sourceSlack.clear();
+  reset();
+}
+
+void ProbeCutoff::init(VarId var, std::vector<Term>&& terms, size_t numVars) {
+  clear();
+  std::sort(terms.begin(), terms.end(), [](const Term& a, const Term& b) {
+    return a.position < b.position ||
+           (a.position == b.position && a.source < b.source);
+  });
+
+  _var = var;
+  _terms.reserve(terms.size());
+  _sources.reserve(terms.size());
+  _termLevels.reserve(terms.size());
+  _coeffs.reserve(terms.size());
+  _minTermValues.reserve(terms.size());
+  _committedSlack.reserve(terms.size());
+  _termsEnd.assign(numVars, 0);
+  _sourceSlack.assign(numVars, 0);
+
+  for (size_t i = 0; i < terms.size(); ++i) {
+    const Term& term = terms[i];
+    if (_levelPositions.empty() || _levelPositions.back() != term.position) {
+      _levelPositions.emplace_back(term.position);
+      _levelSlack.emplace_back(0);
+    }
+    const Int v1 = term.coeff * _solver.lowerBound(term.var);
+    const Int v2 = term.coeff * _solver.upperBound(term.var);
+    _terms.emplace_back(term.var);
+    _sources.emplace_back(term.source);
+    _termLevels.emplace_back(_levelPositions.size() - 1);
+    _coeffs.emplace_back(term.coeff);
+    _minTermValues.emplace_back(std::min(v1, v2));
+    _committedSlack.emplace_back(
+        term.coeff * _solver.committedValue(term.var) - _minTermValues.back());
+    _totalSlack += _committedSlack.back();
+    _levelSlack.back() += _committedSlack.back();
+    _sourceSlack[term.source] += _committedSlack.back();
+    _termsEnd[term.source] = i + 1;
+  }
+  reset();
+}
+
+Int ProbeCutoff::lowerBound(Timestamp ts, size_t position) {
+  while (_level < _levelPositions.size() &&
+         _levelPositions[_level] <= position) {
+    _laterSlack -= _levelSlack[_level];
+    ++_level;
+  }
+  return _solver.value(ts, _var) - _pendingSlack - _laterSlack;
+}
+
+void ProbeCutoff::commit(VarId id) {
+  assert(isTermSource(id));
+  // The terms with the same source are adjacent:
+  for (size_t i = _termsEnd[id]; i > 0; --i) {
+    const size_t index = i - 1;
+    if (_sources[index] != id) {
+      break;
+    }
+    const Int slack = _coeffs[index] * _solver.committedValue(_terms[index]) -
+                      _minTermValues[index];
+    const Int delta = slack - _committedSlack[index];
+    if (delta != 0) {
+      _committedSlack[index] = slack;
+      _totalSlack += delta;
+      _levelSlack[_termLevels[index]] += delta;
+      _sourceSlack[id] += delta;
+    }
+  }
+}
+
+}  // namespace atlantis::propagation
@@ -21,7 +21,8 @@ inline bool all_in_range(size_t start, size_t stop,
   return std::all_of(vec.begin(), vec.end(), std::move(predicate));
 }
 
-PropagationGraph::PropagationGraph(const Store& store, size_t expectedSize)
+PropagationGraph::PropagationGraph(const Store& store, size_t expectedSize,
+                                   PropagationQueueType queueType)
     : _store(store),
       _definingInvariant(),
       _varsDefinedByInvariant(),
@@ -29,7 +30,8 @@ PropagationGraph::PropagationGraph(const Store& store, size_t expectedSize)
       _isDynamicInvariant(),
       _listeningInvariantData(),
       _varLayerIndex(),
-      _varPosition() {
+      _varPosition(),
+      _propagationQueueType(queueType) {
   _definingInvariant.reserve(expectedSize);
   _varsDefinedByInvariant.reserve(expectedSize);
   _inputVars.reserve(expectedSize);
@@ -40,6 +42,7 @@ PropagationGraph::PropagationGraph(const Store& store, size_t expectedSize)
 }
 
 void PropagationGraph::registerInvariant(InvariantId invariantId) {
+  thaw();
   // Everything must be registered in sequence.
   assert(invariantId == _varsDefinedByInvariant.size());
   assert(invariantId == _isDynamicInvariant.size());
@@ -52,6 +55,7 @@ void PropagationGraph::registerInvariant(InvariantId invariantId) {
 }
 
 void PropagationGraph::registerVar(VarId id) {
+  thaw();
   assert(id == _definingInvariant.size());
   assert(id == _listeningInvariantData.size());
   assert(id == _varLayerIndex.size());
@@ -67,6 +71,7 @@ void PropagationGraph::registerVar(VarId id) {
 void PropagationGraph::registerInvariantInput(InvariantId invariantId,
                                               VarId varId, LocalId localId,
                                               bool isDynamicInput) {
+  thaw();
   assert(invariantId != NULL_ID && varId != NULL_ID);
   assert(varId < _definingInvariant.size());
   if (_definingInvariant[varId] == invariantId) {
@@ -85,6 +90,7 @@ void PropagationGraph::registerInvariantInput(InvariantId invariantId,
 
 void PropagationGraph::registerDefinedVar(VarId varId,
                                           InvariantId invariantId) {
+  thaw();
   assert(varId != NULL_ID && invariantId != NULL_ID);
   if (_definingInvariant.at(varId) != NULL_ID) {
     throw VarAlreadyDefinedException(
@@ -112,6 +118,7 @@ void PropagationGraph::registerDefinedVar(VarId varId,
 }
 
 void PropagationGraph::close(Timestamp ts) {
+  thaw();
   _isSearchVar.resize(numVars());
   _isEvaluationVar.resize(numVars());
   _evaluationVars.clear();
@@ -130,14 +137,59 @@ void PropagationGraph::close(Timestamp ts) {
   partitionIntoLayers();
   mergeLayersWithoutDynamicCycles();
   computeLayerOffsets();
+  _orderedDynamicInput.assign(numInvariants(), NULL_ID);
+  _uncommittedDynamicInvariants.assign(numLayers(), {});
+  _isUncommittedDynamicInvariant.assign(numInvariants(), false);
   topologicallyOrder(ts);
   // Reset propagation queue data structure.
   // TODO: Be sure that this does not cause a memeory leak...
   // _propagationQueue = PropagationQueue();
-  _propagationQueue.init(numVars(), numLayers());
-  for (VarId vId = 0; vId < numVars(); ++vId) {
-    _propagationQueue.initVar(vId, varPosition(vId));
+  if (_propagationQueueType == PropagationQueueType::BUCKET) {
+    _bucketPropagationQueue.init(numVars(), numLayers());
+    for (VarId vId = 0; vId < numVars(); ++vId) {
+      _bucketPropagationQueue.initVar(vId, varPosition(vId));
+    }
+  } else {
+    _propagationQueue.init(numVars(), numLayers());
+    for (VarId vId = 0; vId < numVars(); ++vId) {
+      _propagationQueue.initVar(vId, varPosition(vId));
+    }
+  }
+  freeze();
+}
+
+void PropagationGraph::freeze() {
+  if (_isFrozen) {
+    return;
+  }
+  // Order the listening invariants of each variable by their position, so
+  // that notifying them walks the invariants in topological order:
+  const auto position = [&](InvariantId invariantId) {
+    return varsDefinedBy(invariantId).empty() ? 0
+                                              : invariantPosition(invariantId);
+  };
+  for (auto& listeningInvariants : _listeningInvariantData) {
+    std::stable_sort(listeningInvariants.begin(), listeningInvariants.end(),
+                     [&](const ListeningInvariantData& left,
+                         const ListeningInvariantData& right) {
+                       return position(left.invariantId) <
+                              position(right.invariantId);
+                     });
   }
+  _frozenVarsDefinedByInvariant.compress(_varsDefinedByInvariant);
+  _frozenInputVars.compress(_inputVars);
+  _frozenListeningInvariantData.compress(_listeningInvariantData);
+  _isFrozen = true;
+}
+
+void PropagationGraph::thaw() {
+  if (!_isFrozen) {
+    return;
+  }
+  _frozenVarsDefinedByInvariant.decompress(_varsDefinedByInvariant);
+  _frozenInputVars.decompress(_inputVars);
+  _frozenListeningInvariantData.decompress(_listeningInvariantData);
+  _isFrozen = false;
 }
 
 bool PropagationGraph::containsStaticCycle(std::vector<bool>& visited,
@@ -428,7 +480,7 @@ void PropagationGraph::topologicallyOrder(const Timestamp ts,
                        return _varLayerIndex[p.first].layer <= layer;
                      }));
 
-  for (const auto& [inputId, isDynamicInput] : _inputVars[defInv]) {
+  for (const auto& [inputId, isDynamicInput] : inputVars(defInv)) {
     if (!isDynInv || !isDynamicInput) {
       if (_varLayerIndex[inputId].layer == layer &&
           _varPosition[inputId] == numVars()) {
@@ -502,6 +554,9 @@ void PropagationGraph::topologicallyOrder(Timestamp ts, size_t layer,
     }
     const bool isDynInv =
         _layerHasDynamicCycle.at(layer) && isDynamicInvariant(defInv);
+    if (isDynInv) {
+      _orderedDynamicInput[defInv] = dynamicInputVar(ts, defInv);
+    }
 
     for (const auto& [inputId, isDynamicInput] : inputVars(defInv)) {
       if ((!isDynInv || !isDynamicInput ||
@@ -513,8 +568,14 @@ void PropagationGraph::topologicallyOrder(Timestamp ts, size_t layer,
   }
 
   if (updatePriorityQueue) {
-    for (const VarId varId : _varsInLayer[layer]) {
-      _propagationQueue.updatePriority(varId, _varPosition.at(varId));
+    if (_propagationQueueType == PropagationQueueType::BUCKET) {
+      for (const VarId varId : _varsInLayer[layer]) {
+        _bucketPropagationQueue.updatePriority(varId, _varPosition.at(varId));
+      }
+    } else {
+      for (const VarId varId : _varsInLayer[layer]) {
+        _propagationQueue.updatePriority(varId, _varPosition.at(varId));
+      }
     }
   }
 }
@@ -524,4 +585,106 @@ void PropagationGraph::topologicallyOrder(Timestamp ts) {
     topologicallyOrder(ts, layer, false);
   }
 }
+
+bool PropagationGraph::raisePositions(InvariantId invariantId, size_t position,
+                                      size_t& budget) {
+  _raiseStack.clear();
+  _raiseStack.emplace_back(invariantId, position);
+  while (!_raiseStack.empty()) {
+    const auto [raisedId, raisedPosition] = _raiseStack.back();
+    _raiseStack.pop_back();
+    const std::span<const VarId> definedVars = varsDefinedBy(raisedId);
+    assert(!definedVars.empty());
+    if (_varPosition[definedVars.front()] >= raisedPosition) {
+      continue;
+    }
+    if (raisedPosition >= numVars() || budget == 0) {
+      return false;
+    }
+    --budget;
+    // All variables defined by an invariant share the same position:
+    for (const VarId varId : definedVars) {
+      _varPosition[varId] = raisedPosition;
+      if (_propagationQueueType == PropagationQueueType::BUCKET) {
+        _bucketPropagationQueue.updatePriority(varId, raisedPosition);
+      } else {
+        _propagationQueue.updatePriority(varId, raisedPosition);
+      }
+    }
+    for (const VarId varId : definedVars) {
+      for (const auto& listener : listeningInvariantData(varId)) {
+        const InvariantId listenerId = listener.invariantId;
+        if (varsDefinedBy(listenerId).empty()) {
+          continue;
+        }
+        // The inputs of a dynamic invariant in a layer with dynamic cycles
+        // that are in the same layer as the invariant are dynamic, and only
+        // the ordered dynamic input is an edge of the order. Inputs in
+        // previous layers are conservatively treated as edges:
+        if (_orderedDynamicInput[listenerId] != NULL_ID &&
+            _orderedDynamicInput[listenerId] != varId &&
+            varLayer(varId) == invariantLayer(listenerId)) {
+          continue;
+        }
+        if (invariantPosition(listenerId) <= raisedPosition) {
+          _raiseStack.emplace_back(listenerId, raisedPosition + 1);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void PropagationGraph::updateTopologicalOrder(
+    Timestamp ts, size_t layer, std::span<const VarId> modifiedVars) {
+  assert(layer < numLayers());
+  assert(_layerHasDynamicCycle[layer]);
+
+  // The dynamic input of an invariant can only differ from the ordered one
+  // if the invariant has been notified at ts, or if the ordered one was set
+  // by a previous (uncommitted) propagation:
+  _changedDynamicInvariants.clear();
+  std::vector<InvariantId>& uncommitted = _uncommittedDynamicInvariants[layer];
+  for (const InvariantId invariantId : uncommitted) {
+    _isUncommittedDynamicInvariant[invariantId] = false;
+    _changedDynamicInvariants.emplace_back(invariantId);
+  }
+  uncommitted.clear();
+  for (const VarId varId : modifiedVars) {
+    const InvariantId invariantId = definingInvariant(varId);
+    if (invariantId == NULL_ID ||
+        _orderedDynamicInput[invariantId] == NULL_ID) {
+      continue;
+    }
+    _changedDynamicInvariants.emplace_back(invariantId);
+    if (!_isUncommittedDynamicInvariant[invariantId]) {
+      _isUncommittedDynamicInvariant[invariantId] = true;
+      uncommitted.emplace_back(invariantId);
+    }
+  }
+
+  // Update the ordered dynamic inputs before repairing the order, as the
+  // repair follows the ordered dynamic inputs:
+  size_t numChanged = 0;
+  for (const InvariantId invariantId : _changedDynamicInvariants) {
+    const VarId dynamicInputId = dynamicInputVar(ts, invariantId);
+    if (dynamicInputId != _orderedDynamicInput[invariantId]) {
+      _orderedDynamicInput[invariantId] = dynamicInputId;
+      _changedDynamicInvariants[numChanged++] = invariantId;
+    }
+  }
+  _changedDynamicInvariants.resize(numChanged);
+
+  size_t budget = _varsInLayer[layer].size();
+  for (const InvariantId invariantId : _changedDynamicInvariants) {
+    const VarId dynamicInputId = _orderedDynamicInput[invariantId];
+    if (!raisePositions(invariantId, _varPosition[dynamicInputId] + 1,
+                        budget)) {
+      // Either the repair is too expensive or the dynamic inputs form a
+      // cycle (in which case ordering the layer throws):
+      topologicallyOrder(ts, layer, true);
+      return;
+    }
+  }
+}
 }  // namespace atlantis::propagation
@@ -0,0 +1,57 @@
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
+
+namespace atlantis::propagation {
+
+void SearchVarAncestors::assign(std::vector<size_t>&& searchVarIndex,
+                                std::vector<std::vector<Block>>& ancestors) {
+  assert(searchVarIndex.size() == ancestors.size());
+  assert(std::all_of(ancestors.begin(), ancestors.end(),
+                     [](const std::vector<Block>& blocks) {
+                       return std::is_sorted(
+                           blocks.begin(), blocks.end(),
+                           [](const Block& a, const Block& b) {
+                             return a.index < b.index;
+                           });
+                     }));
+  _searchVarIndex = std::move(searchVarIndex);
+  _ancestors.compress(ancestors);
+  _modified.clear();
+}
+
+void SearchVarAncestors::clear() {
+  _searchVarIndex.clear();
+  _searchVarIndex.shrink_to_fit();
+  _ancestors.clear();
+  _modified.clear();
+}
+
+void SearchVarAncestors::setModified(
+    const std::unordered_set<VarId>& modifiedSearchVars) {
+  _modified.clear();
+  for (const VarId id : modifiedSearchVars) {
+    const size_t index = searchVarIndex(id);
+    assert(index != NOT_A_SEARCH_VAR);
+    _modified.emplace_back(
+        Block{index / BLOCK_SIZE, uint64_t(1) << (index % BLOCK_SIZE)});
+  }
+  std::sort(_modified.begin(), _modified.end(),
+            [](const Block& a, const Block& b) { return a.index < b.index; });
+  // Merge the blocks with the same index:
+  size_t numBlocks = 0;
+  for (size_t i = 0; i < _modified.size(); ++i) {
+    if (numBlocks > 0 && _modified[numBlocks - 1].index == _modified[i].index) {
+      _modified[numBlocks - 1].bits |= _modified[i].bits;
+    } else {
+      _modified[numBlocks++] = _modified[i];
+    }
+  }
+  _modified.resize(numBlocks);
+}
+
+size_t SearchVarAncestors::memoryUsage() const noexcept {
+  return _searchVarIndex.capacity() * sizeof(size_t) +
+         (_ancestors.numRows() + 1) * sizeof(size_t) +
+         _ancestors.numElements() * sizeof(Block);
+}
+
+}  // namespace atlantis::propagation
@@ -7,13 +7,14 @@
 
 namespace atlantis::propagation {
 
-Solver::Solver()
+Solver::Solver(PropagationQueueType queueType)
     : _propagationMode(PropagationMode::INPUT_TO_OUTPUT),
-      _propGraph(_store, ESTIMATED_NUM_OBJECTS),
+      _propGraph(_store, ESTIMATED_NUM_OBJECTS, queueType),
       _outputToInputExplorer(*this, ESTIMATED_NUM_OBJECTS),
-      _isEnqueued(),
-      _modifiedSearchVars() {
-  _isEnqueued.reserve(ESTIMATED_NUM_OBJECTS);
+      _enqueuedAt(),
+      _modifiedSearchVars(),
+      _probeCutoff(*this) {
+  _enqueuedAt.reserve(ESTIMATED_NUM_OBJECTS);
 }
 
 void Solver::open() {
@@ -69,7 +70,7 @@ void Solver::close() {
   // then it is in the set of modified search variables
   assert(std::all_of(
       searchVars().begin(), searchVars().end(), [&](const VarId varId) {
-        return _store.intVar(varId).hasChanged(_currentTimestamp) ==
+        return _store.hasChanged(_currentTimestamp, varId) ==
                _modifiedSearchVars.contains(varId);
       }));
 
@@ -83,24 +84,90 @@ void Solver::close() {
   // assert that decsion variable varId is no longer modified.
   assert(std::all_of(_modifiedSearchVars.begin(), _modifiedSearchVars.end(),
                      [&](const size_t varId) {
-                       return !_store.intVar(varId).hasChanged(
-                           _currentTimestamp);
+                       return !_store.hasChanged(_currentTimestamp, varId);
                      }));
+
+  initProbeCutoff();
+  initPendingNotifications();
+}
+
+bool Solver::setProbeCutoffVar(VarViewId id) {
+  if (_isOpen) {
+    throw SolverOpenException(
+        "Cannot set the probe cut-off variable when model is open");
+  }
+  _probeCutoffVarId = id;
+  initProbeCutoff();
+  initPendingNotifications();
+  return _probeCutoff.isActive();
+}
+
+void Solver::initProbeCutoff() {
+  _probeCutoff.clear();
+  if (_probeCutoffVarId == NULL_ID || !_probeCutoffVarId.isVar() ||
+      _propGraph.numLayers() != 1) {
+    return;
+  }
+  const VarId var(_probeCutoffVarId);
+  const InvariantId invariantId = _propGraph.definingInvariant(var);
+  if (invariantId == NULL_ID) {
+    return;
+  }
+  const Invariant& invariant = _store.invariant(invariantId);
+  std::vector<std::pair<VarViewId, Int>> linearTerms;
+  if (invariant.primaryDefinedVar() != var ||
+      !invariant.linearTerms(linearTerms)) {
+    return;
+  }
+  std::vector<ProbeCutoff::Term> terms;
+  terms.reserve(linearTerms.size());
+  for (const auto& [term, coeff] : linearTerms) {
+    const VarId source = sourceId(term);
+    const InvariantId defInv = _propGraph.definingInvariant(source);
+    // A non-primary defined variable is only enqueued when the primary
+    // defined variable is dequeued, so its value can change after
+    // variables at the same position have been dequeued:
+    if (defInv != NULL_ID &&
+        _store.invariant(defInv).primaryDefinedVar() != source) {
+      return;
+    }
+    terms.emplace_back(ProbeCutoff::Term{_propGraph.varPosition(source),
+                                         source, term, coeff});
+  }
+  _probeCutoff.init(var, std::move(terms), numVars());
+}
+
+void Solver::initPendingNotifications() {
+  const InvariantId cutoffInvariant =
+      _probeCutoff.isActive()
+          ? _propGraph.definingInvariant(VarId(_probeCutoffVarId))
+          : InvariantId(NULL_ID);
+  _pendingNotifications.assign(numInvariants(), PendingNotifications{});
+  for (InvariantId invariantId = 0; invariantId < numInvariants();
+       ++invariantId) {
+    // The output of a dynamic invariant is not always enqueued when it is
+    // notified, and the probe cut-off bound relies on the cut-off variable
+    // being up to date with the dequeued terms:
+    _pendingNotifications[invariantId].isBatched =
+        inputVars(invariantId).size() >= BATCH_MIN_INPUTS &&
+        _store.invariant(invariantId).batchesInputChanges() &&
+        !_propGraph.isDynamicInvariant(invariantId) &&
+        invariantId != cutoffInvariant;
+  }
 }
 
 //---------------------Registration---------------------
 void Solver::enqueueDefinedVar(VarId id) {
-  assert(id < _isEnqueued.size());
-  if (_isEnqueued[id]) {
+  if (isEnqueued(id)) {
     return;
   }
   _propGraph.enqueuePropagationQueue(id);
-  _isEnqueued[id] = true;
+  setEnqueued(id);
+  _probeCutoff.enqueued(id);
 }
 
 void Solver::enqueueDefinedVar(VarId id, size_t curLayer) {
-  assert(id < _isEnqueued.size());
-  if (_isEnqueued[id]) {
+  if (isEnqueued(id)) {
     return;
   }
   const size_t varLayer = _propGraph.varLayer(id);
@@ -110,11 +177,11 @@ void Solver::enqueueDefinedVar(VarId id, size_t curLayer) {
     assert(
         std::all_of(_layerQueue[varLayer].begin(),
                     _layerQueue[varLayer].begin() + _layerQueueIndex[varLayer],
-                    [&](const VarId vId) { return _isEnqueued.at(vId); }));
+                    [&](const VarId vId) { return isEnqueued(vId); }));
     _layerQueue[varLayer][_layerQueueIndex[varLayer]] = id;
     ++_layerQueueIndex[varLayer];
   }
-  _isEnqueued[id] = true;
+  setEnqueued(id);
 }
 
 void Solver::registerInvariantInput(InvariantId invariantId, VarViewId inputId,
@@ -131,8 +198,8 @@ void Solver::registerVar(VarId id) {
   _numVars++;
   _propGraph.registerVar(id);
   _outputToInputExplorer.registerVar(id);
-  assert(id == _isEnqueued.size());
-  _isEnqueued.emplace_back(false);
+  assert(id == _enqueuedAt.size());
+  _enqueuedAt.emplace_back(NULL_TIMESTAMP);
 }
 
 void Solver::registerInvariant(InvariantId invariantId) {
@@ -152,8 +219,9 @@ VarId Solver::dequeueComputedVar(Timestamp) {
 }
 
 void Solver::clearPropagationQueue() {
+  // The enqueued flags are stamped with the timestamp they were set at, so
+  // only the (typically empty) queue itself needs to be cleared:
   _propGraph.clearPropagationQueue();
-  _isEnqueued.assign(_isEnqueued.size(), false);
 }
 
 void Solver::closeInvariants() {
@@ -199,25 +267,7 @@ void Solver::endProbe() {
 
   _solverState = SolverState::PROCESSING;
   try {
-    if (_propagationMode == PropagationMode::INPUT_TO_OUTPUT) {
-      if (_propGraph.numLayers() == 1) {
-        propagate<CommitMode::NO_COMMIT, true>();
-      } else {
-        propagate<CommitMode::NO_COMMIT, false>();
-      }
-    } else {
-      // Assert that if decision variable varId is modified,
-      // then it is in the set of modified decision variables
-      assert(outputToInputMarkingMode() !=
-                 OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC ||
-             std::all_of(searchVars().begin(), searchVars().end(),
-                         [&](const VarId varId) {
-                           return _store.intVar(varId).hasChanged(
-                                      _currentTimestamp) ==
-                                  _modifiedSearchVars.contains(varId);
-                         }));
-      outputToInputPropagate();
-    }
+    propagateProbe();
     _solverState = SolverState::IDLE;
   } catch (std::exception const& e) {
     _solverState = SolverState::IDLE;
@@ -225,10 +275,78 @@ void Solver::endProbe() {
   }
 }
 
+bool Solver::endBoundedProbe(Int maxValue) {
+  if (!canBoundProbes()) {
+    endProbe();
+    return true;
+  }
+  _probeCutoffValue = maxValue;
+  try {
+    endProbe();
+  } catch (std::exception const& e) {
+    _probeCutoffValue = std::numeric_limits<Int>::max();
+    throw e;
+  }
+  _probeCutoffValue = std::numeric_limits<Int>::max();
+  return !_probeWasCutOff;
+}
+
+void Solver::propagateProbe() {
+  assert(_solverState == SolverState::PROCESSING);
+  _probedAt = NULL_TIMESTAMP;
+  _probeWasCutOff = false;
+  if (_propagationMode == PropagationMode::INPUT_TO_OUTPUT) {
+    _probedVars.clear();
+    if (_propGraph.numLayers() == 1) {
+      propagate<CommitMode::NO_COMMIT, true>();
+    } else {
+      propagate<CommitMode::NO_COMMIT, false>();
+    }
+    if (!_probeWasCutOff) {
+      _probedAt = _currentTimestamp;
+    }
+  } else {
+    // Assert that if decision variable varId is modified,
+    // then it is in the set of modified decision variables
+    assert(outputToInputMarkingMode() !=
+               OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC ||
+           std::all_of(searchVars().begin(), searchVars().end(),
+                       [&](const VarId varId) {
+                         return _store.hasChanged(_currentTimestamp, varId) ==
+                                _modifiedSearchVars.contains(varId);
+                       }));
+    outputToInputPropagate();
+  }
+}
+
+void Solver::commitProbe() {
+  assert(!_isOpen);
+  assert(canCommitProbe(_currentTimestamp));
+  // Commit in the same order as propagate<CommitMode::COMMIT> would:
+  for (const VarId varId : _probedVars) {
+    const InvariantId definingInvariant = _propGraph.definingInvariant(varId);
+    if (definingInvariant != NULL_ID) {
+      Invariant& defInv = _store.invariant(definingInvariant);
+      if (varId == defInv.primaryDefinedVar()) {
+        defInv.commit(_currentTimestamp);
+      }
+    }
+    commitIf(_currentTimestamp, varId);
+    if (_probeCutoff.isTermSource(varId)) {
+      _probeCutoff.commit(varId);
+    }
+  }
+  _probedVars.clear();
+  // The probe is now committed:
+  _probedAt = NULL_TIMESTAMP;
+}
+
 void Solver::beginCommit() {
   assert(!_isOpen);
   assert(_solverState == SolverState::IDLE);
 
+  _probedAt = NULL_TIMESTAMP;
+
   _outputToInputExplorer.clearRegisteredVars();
 
   _solverState = SolverState::COMMIT;
@@ -247,8 +365,7 @@ void Solver::endCommit() {
                OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC ||
            std::all_of(searchVars().begin(), searchVars().end(),
                        [&](const VarId varId) {
-                         return _store.intVar(varId).hasChanged(
-                                    _currentTimestamp) ==
+                         return _store.hasChanged(_currentTimestamp, varId) ==
                                 _modifiedSearchVars.contains(varId);
                        }));
     if (_propGraph.numLayers() == 1) {
@@ -261,8 +378,7 @@ void Solver::endCommit() {
     assert(_propagationMode != PropagationMode::OUTPUT_TO_INPUT ||
            std::all_of(_modifiedSearchVars.begin(), _modifiedSearchVars.end(),
                        [&](const size_t varId) {
-                         return !_store.intVar(varId).hasChanged(
-                             _currentTimestamp);
+                         return !_store.hasChanged(_currentTimestamp, varId);
                        }));
     _solverState = SolverState::IDLE;
   } catch (std::exception const& e) {
@@ -306,6 +422,15 @@ template void Solver::propagate<CommitMode::COMMIT, true>();
 // Propagates at the current internal timestamp of the solver.
 template <CommitMode Mode, bool SingleLayer>
 void Solver::propagate() {
+  // Invalidates the pending notifications of any earlier propagation that
+  // was cut off:
+  if (++_propagationRound == 0) {
+    for (PendingNotifications& pending : _pendingNotifications) {
+      pending.round = 0;
+    }
+    _propagationRound = 1;
+  }
+  _pendingInputs.clear();
   size_t curLayer = 0;
   while (true) {
     for (VarId queuedVar = dequeueComputedVar(_currentTimestamp);
@@ -322,12 +447,16 @@ void Solver::propagate() {
         // The usage of primary defined var ensures the following if statement
         // is entered only once per invariant:
         if (queuedVar == defInv.primaryDefinedVar()) {
+          if constexpr (Mode == CommitMode::NO_COMMIT) {
+            // All inputs of the invariant have been dequeued:
+            notifyPendingInputs(definingInvariant, defInv);
+          }
           // enqueue all modified defined vars:
           for (const VarId defVarId : defInv.nonPrimaryDefinedVars()) {
             if (hasChanged(_currentTimestamp, defVarId)) {
-              assert(!_isEnqueued.at(defVarId));
+              assert(!isEnqueued(defVarId));
               _propGraph.enqueuePropagationQueue(defVarId);
-              _isEnqueued[defVarId] = true;
+              setEnqueued(defVarId);
             }
           }
           if constexpr (Mode == CommitMode::COMMIT) {
@@ -337,6 +466,13 @@ void Solver::propagate() {
         }
       }
 
+      if constexpr (Mode == CommitMode::NO_COMMIT) {
+        _probedVars.emplace_back(queuedVar);
+        if (_probeCutoff.isTermSource(queuedVar)) {
+          _probeCutoff.dequeued(queuedVar);
+        }
+      }
+
       if (!hasChanged(_currentTimestamp, queuedVar)) {
         continue;
       }
@@ -347,7 +483,17 @@ void Solver::propagate() {
         const VarId primaryDefinedVar = invariant.primaryDefinedVar();
         assert(primaryDefinedVar != NULL_ID);
         assert(toNotify.invariantId != definingInvariant);
-        invariant.notifyInputChanged(_currentTimestamp, toNotify.localId);
+        if constexpr (Mode == CommitMode::NO_COMMIT) {
+          if (_pendingNotifications[toNotify.invariantId].isBatched) {
+            addPendingInput(toNotify.invariantId, toNotify.localId);
+          } else {
+            invariant.notifyInputChanged(_currentTimestamp, toNotify.localId);
+          }
+        } else {
+          // queuedVar is committed below, so the invariant must be notified
+          // while the committed value of queuedVar is still the old one:
+          invariant.notifyInputChanged(_currentTimestamp, toNotify.localId);
+        }
         if constexpr (SingleLayer) {
           assert(_propGraph.varPosition(queuedVar) <
                  _propGraph.varPosition(primaryDefinedVar));
@@ -370,6 +516,23 @@ void Solver::propagate() {
 
       if constexpr (Mode == CommitMode::COMMIT) {
         commitIf(_currentTimestamp, queuedVar);
+        if (_probeCutoff.isTermSource(queuedVar)) {
+          _probeCutoff.commit(queuedVar);
+        }
+      } else if constexpr (SingleLayer) {
+        if (_probeCutoffValue != std::numeric_limits<Int>::max() &&
+            _probeCutoff.isTermSource(queuedVar)) {
+          // Cut off the probe if the cut-off variable provably exceeds the
+          // maximum value:
+          const Int lowerBound = _probeCutoff.lowerBound(
+              _currentTimestamp, _propGraph.varPosition(queuedVar));
+          if (lowerBound > _probeCutoffValue) {
+            _probeCutoffLowerBound = lowerBound;
+            _probeWasCutOff = true;
+            clearPropagationQueue();
+            return;
+          }
+        }
       }
     }
     // Done with propagating current layer.
@@ -392,13 +555,16 @@ void Solver::propagate() {
       }
       // There are variables to enqueue for the new layer:
       assert(_layerQueueIndex[curLayer] > 0);
-      // Topologically order the new layer if necessary:
+      // Repair the topological order of the new layer if necessary:
       if (_propGraph.hasDynamicCycle(curLayer)) {
-        _propGraph.topologicallyOrder(_currentTimestamp, curLayer);
+        _propGraph.updateTopologicalOrder(
+            _currentTimestamp, curLayer,
+            std::span<const VarId>(_layerQueue[curLayer].data(),
+                                   _layerQueueIndex[curLayer]));
       }
       // Add all queued variables to the propagation queue:
       for (size_t i = 0; i < _layerQueueIndex[curLayer]; ++i) {
-        assert(_isEnqueued.at(_layerQueue[curLayer][i]));
+        assert(isEnqueued(_layerQueue[curLayer][i]));
         _propGraph.enqueuePropagationQueue(_layerQueue[curLayer][i]);
       }
       _layerQueueIndex[curLayer] = 0;
@@ -1,5 +1,15 @@
 #include "atlantis/propagation/solverBase.hpp"
 
+#include <limits>
+
+#include "atlantis/propagation/views/equalConst.hpp"
+#include "atlantis/propagation/views/greaterEqualConst.hpp"
+#include "atlantis/propagation/views/intAbsView.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+#include "atlantis/propagation/views/lessEqualConst.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/views/scalarView.hpp"
+
 namespace atlantis::propagation {
 
 SolverBase::SolverBase()
@@ -19,4 +29,113 @@ VarViewId SolverBase::makeIntVar(Int initValue, Int lowerBound,
   registerVar(VarId(newId));
   return newId;
 }
+
+void SolverBase::reserve(size_t numVars, size_t numInvariants,
+                         size_t numIntViews) {
+  if (!_isOpen) {
+    throw SolverClosedException("Cannot reserve when store is closed.");
+  }
+  _store.reserve(numVars, numInvariants, numIntViews);
+  _intViewKeys.reserve(numIntViews);
+}
+
+void SolverBase::registerIntViewKey(VarViewId viewId, const IntViewKey& key) {
+  assert(viewId.isView() && size_t(viewId) == _intViewKeys.size());
+  _intViewKeys.emplace_back(key);
+  if (key.kind != IntViewKind::NONE) {
+    _intViewIds.emplace(key, viewId);
+  }
+}
+
+VarViewId SolverBase::makeAffineView(VarViewId parentId, Int factor,
+                                     Int offset) {
+  if (factor == 1) {
+    return makeIntView<IntOffsetView>(*this, parentId, offset);
+  }
+  return makeIntView<ScalarView>(*this, parentId, factor, offset);
+}
+
+VarViewId SolverBase::normalisedIntView(const IntViewKey& key) {
+  const auto it = _intViewIds.find(key);
+  if (it != _intViewIds.end()) {
+    return it->second;
+  }
+  if (!key.parentId.isView()) {
+    return NULL_ID;
+  }
+  // Only views over an affine view (factor * source + offset) are fused:
+  const IntViewKey& parentKey = _intViewKeys[size_t(key.parentId)];
+  Int factor;
+  Int offset;
+  if (parentKey.kind == IntViewKind::OFFSET) {
+    factor = 1;
+    offset = parentKey.arg0;
+  } else if (parentKey.kind == IntViewKind::SCALAR) {
+    factor = parentKey.arg0;
+    offset = parentKey.arg1;
+  } else {
+    return NULL_ID;
+  }
+  const VarViewId sourceId = parentKey.parentId;
+  // The constants of the fused view must not overflow:
+  Int fusedFactor;
+  Int fusedOffset;
+  switch (key.kind) {
+    case IntViewKind::OFFSET:
+      if (__builtin_add_overflow(offset, key.arg0, &fusedOffset)) {
+        return NULL_ID;
+      }
+      return makeAffineView(sourceId, factor, fusedOffset);
+    case IntViewKind::SCALAR:
+      if (__builtin_mul_overflow(key.arg0, factor, &fusedFactor) ||
+          __builtin_mul_overflow(key.arg0, offset, &fusedOffset) ||
+          __builtin_add_overflow(fusedOffset, key.arg1, &fusedOffset)) {
+        return NULL_ID;
+      }
+      return makeAffineView(sourceId, fusedFactor, fusedOffset);
+    case IntViewKind::ABS:
+      // |-source| = |source|
+      if (factor == -1 && offset == 0) {
+        return makeIntView<IntAbsView>(*this, sourceId);
+      }
+      return NULL_ID;
+    case IntViewKind::MOD:
+    case IntViewKind::NONE:
+      return NULL_ID;
+    default:
+      break;
+  }
+  // The remaining kinds compare the affine view against a constant, which is
+  // fused into a comparison of the source against a shifted constant:
+  Int diff;
+  if (__builtin_sub_overflow(key.arg0, offset, &diff) ||
+      diff == std::numeric_limits<Int>::min()) {
+    return NULL_ID;
+  }
+  if (key.kind == IntViewKind::NOT_EQUAL_CONST) {
+    // factor * source + offset == val <=> source == (val - offset) / factor
+    if (factor == 0 || diff % factor != 0) {
+      return NULL_ID;
+    }
+    return makeIntView<NotEqualConst>(*this, sourceId, diff / factor);
+  }
+  if (factor != 1 && factor != -1) {
+    return NULL_ID;
+  }
+  // For factor in {-1, 1}: factor * source + offset - val
+  //                      = factor * (source - factor * (val - offset)):
+  const Int val = factor * diff;
+  switch (key.kind) {
+    case IntViewKind::EQUAL_CONST:
+      return makeIntView<EqualConst>(*this, sourceId, val);
+    case IntViewKind::LESS_EQUAL_CONST:
+      return factor == 1 ? makeIntView<LessEqualConst>(*this, sourceId, val)
+                         : makeIntView<GreaterEqualConst>(*this, sourceId, val);
+    case IntViewKind::GREATER_EQUAL_CONST:
+      return factor == 1 ? makeIntView<GreaterEqualConst>(*this, sourceId, val)
+                         : makeIntView<LessEqualConst>(*this, sourceId, val);
+    default:
+      return NULL_ID;
+  }
+}
 }  // namespace atlantis::propagation
@@ -0,0 +1,180 @@
+#include "atlantis/propagation/utils/kernels.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ATLANTIS_AVX2_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace atlantis::propagation::kernels {
+
+// The scalar kernels accumulate in unsigned integers, which wrap around
+// instead of overflowing:
+using UInt = std::uint64_t;
+
+static Int scalarDotProduct(const Int* coeffs, const Int* values,
+                            size_t size) noexcept {
+  UInt acc[4] = {0, 0, 0, 0};
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    for (size_t lane = 0; lane < 4; ++lane) {
+      acc[lane] += static_cast<UInt>(coeffs[i + lane]) *
+                   static_cast<UInt>(values[i + lane]);
+    }
+  }
+  for (; i < size; ++i) {
+    acc[0] += static_cast<UInt>(coeffs[i]) * static_cast<UInt>(values[i]);
+  }
+  return static_cast<Int>(acc[0] + acc[1] + acc[2] + acc[3]);
+}
+
+static Int scalarCountEqual(const Int* values, size_t size,
+                            Int needle) noexcept {
+  Int count = 0;
+  for (size_t i = 0; i < size; ++i) {
+    count += static_cast<Int>(values[i] == needle);
+  }
+  return count;
+}
+
+static Int scalarSumWhereEqual(const Int* coeffs, const Int* values,
+                               size_t size, Int needle) noexcept {
+  UInt sum = 0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += values[i] == needle ? static_cast<UInt>(coeffs[i]) : 0;
+  }
+  return static_cast<Int>(sum);
+}
+
+#ifdef ATLANTIS_AVX2_KERNELS
+
+// The AVX2 kernels handle their remainders themselves, since calling the
+// (SSE-compiled) scalar kernels with dirty upper halves of the ymm registers
+// would incur a transition penalty:
+
+[[gnu::target("avx2")]] static inline __m256i load(const Int* data) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+[[gnu::target("avx2")]] static inline Int horizontalSum(__m256i v) noexcept {
+  alignas(32) UInt lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+  return static_cast<Int>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+// AVX2 has no 64-bit multiplication, so the (wrapping) product is composed
+// of the 32-bit halves: a * b = lo(a)lo(b) + ((hi(a)lo(b) + lo(a)hi(b)) << 32)
+[[gnu::target("avx2")]] static inline __m256i mul64(__m256i a,
+                                                     __m256i b) noexcept {
+  const __m256i low = _mm256_mul_epu32(a, b);
+  const __m256i cross =
+      _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                       _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+  return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+[[gnu::target("avx2")]] static Int avx2DotProduct(const Int* coeffs,
+                                                  const Int* values,
+                                                  size_t size) noexcept {
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    acc0 = _mm256_add_epi64(acc0, mul64(load(coeffs + i), load(values + i)));
+    acc1 = _mm256_add_epi64(acc1,
+                            mul64(load(coeffs + i + 4), load(values + i + 4)));
+  }
+  auto sum = static_cast<UInt>(horizontalSum(_mm256_add_epi64(acc0, acc1)));
+  for (; i < size; ++i) {
+    sum += static_cast<UInt>(coeffs[i]) * static_cast<UInt>(values[i]);
+  }
+  return static_cast<Int>(sum);
+}
+
+[[gnu::target("avx2")]] static Int avx2CountEqual(const Int* values,
+                                                  size_t size,
+                                                  Int needle) noexcept {
+  const __m256i needles = _mm256_set1_epi64x(needle);
+  // The comparison yields -1 in the lanes that are equal:
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(load(values + i), needles));
+  }
+  Int count = horizontalSum(acc);
+  for (; i < size; ++i) {
+    count += static_cast<Int>(values[i] == needle);
+  }
+  return count;
+}
+
+[[gnu::target("avx2")]] static Int avx2SumWhereEqual(const Int* coeffs,
+                                                     const Int* values,
+                                                     size_t size,
+                                                     Int needle) noexcept {
+  const __m256i needles = _mm256_set1_epi64x(needle);
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const __m256i isEqual = _mm256_cmpeq_epi64(load(values + i), needles);
+    acc = _mm256_add_epi64(acc, _mm256_and_si256(isEqual, load(coeffs + i)));
+  }
+  auto sum = static_cast<UInt>(horizontalSum(acc));
+  for (; i < size; ++i) {
+    sum += values[i] == needle ? static_cast<UInt>(coeffs[i]) : 0;
+  }
+  return static_cast<Int>(sum);
+}
+
+static bool hasAvx2() noexcept {
+  static const bool result = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  return result;
+}
+
+#else
+
+static bool hasAvx2() noexcept { return false; }
+
+#endif
+
+Int dotProduct(std::span<const Int> coeffs,
+               std::span<const Int> values) noexcept {
+  assert(coeffs.size() == values.size());
+#ifdef ATLANTIS_AVX2_KERNELS
+  if (hasAvx2()) {
+    return avx2DotProduct(coeffs.data(), values.data(), values.size());
+  }
+#endif
+  return scalarDotProduct(coeffs.data(), values.data(), values.size());
+}
+
+Int countEqual(std::span<const Int> values, Int needle) noexcept {
+#ifdef ATLANTIS_AVX2_KERNELS
+  if (hasAvx2()) {
+    return avx2CountEqual(values.data(), values.size(), needle);
+  }
+#endif
+  return scalarCountEqual(values.data(), values.size(), needle);
+}
+
+Int sumWhereEqual(std::span<const Int> coeffs, std::span<const Int> values,
+                  Int needle) noexcept {
+  assert(coeffs.size() == values.size());
+#ifdef ATLANTIS_AVX2_KERNELS
+  if (hasAvx2()) {
+    return avx2SumWhereEqual(coeffs.data(), values.data(), values.size(),
+                             needle);
+  }
+#endif
+  return scalarSumWhereEqual(coeffs.data(), values.data(), values.size(),
+                             needle);
+}
+
+bool usesAvx2() noexcept { return hasAvx2(); }
+
+}  // namespace atlantis::propagation::kernels
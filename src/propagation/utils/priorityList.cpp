@@ -3,11 +3,12 @@
 namespace atlantis::propagation {
 
 PriorityList::PriorityList(size_t size)
-    : _minimum(NULL_TIMESTAMP, 0), _maximum(NULL_TIMESTAMP, 0) {
+    : _journal(), _minimum(NULL_TIMESTAMP, 0), _maximum(NULL_TIMESTAMP, 0) {
   _list.reserve(size);
   for (size_t i = 0; i < size; i++) {
     _list.emplace_back(NULL_TIMESTAMP, 0);
   }
+  _journal.touchAll(NULL_TIMESTAMP, size);
 }
 
 size_t PriorityList::size() const noexcept { return _list.size(); }
@@ -21,8 +22,8 @@ Int PriorityList::maxPriority(Timestamp ts) const noexcept {
 }
 
 void PriorityList::commitIf(Timestamp ts) {
-  for (auto& node : _list) {
-    node.commitIf(ts);
+  for (const size_t idx : _journal.modified(ts)) {
+    _list[idx].commitIf(ts);
   }
 
   _minimum.commitIf(ts);
@@ -37,6 +38,7 @@ void PriorityList::updatePriority(Timestamp ts, size_t idx, Int newValue) {
 
   auto min = minPriority(ts);
   auto max = maxPriority(ts);
+  _journal.touch(ts, idx, _list[idx].tmpTimestamp());
   _list[idx].set(ts, newValue);
 
   if (newValue > max) {
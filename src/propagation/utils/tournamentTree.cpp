@@ -0,0 +1,62 @@
+#include "atlantis/propagation/utils/tournamentTree.hpp"
+
+#include <limits>
+
+namespace atlantis::propagation {
+
+template <bool IsMax>
+TournamentTree<IsMax>::TournamentTree(size_t size)
+    : _size(size), _firstLeaf(1), _nodes(), _journal() {
+  assert(size > 0);
+  while (_firstLeaf < _size) {
+    _firstLeaf <<= 1;
+  }
+  // The padding leaves never win:
+  const Int padding = IsMax ? std::numeric_limits<Int>::min()
+                            : std::numeric_limits<Int>::max();
+  _nodes.reserve(2 * _firstLeaf);
+  for (size_t node = 0; node < _firstLeaf; ++node) {
+    _nodes.emplace_back(NULL_TIMESTAMP, 0);
+  }
+  for (size_t idx = 0; idx < _firstLeaf; ++idx) {
+    _nodes.emplace_back(NULL_TIMESTAMP, idx < _size ? 0 : padding);
+  }
+  for (size_t node = _firstLeaf - 1; node > 0; --node) {
+    _nodes[node].init(NULL_TIMESTAMP,
+                      best(_nodes[2 * node].get(NULL_TIMESTAMP),
+                           _nodes[2 * node + 1].get(NULL_TIMESTAMP)));
+  }
+  _journal.touchAll(NULL_TIMESTAMP, _nodes.size());
+}
+
+template <bool IsMax>
+void TournamentTree<IsMax>::updatePriority(Timestamp ts, size_t idx,
+                                           Int newValue) {
+  assert(idx < _size);
+  size_t node = _firstLeaf + idx;
+  if (_nodes[node].get(ts) == newValue) {
+    return;
+  }
+  set(ts, node, newValue);
+  for (node >>= 1; node > 0; node >>= 1) {
+    const Int winner =
+        best(_nodes[2 * node].get(ts), _nodes[2 * node + 1].get(ts));
+    if (_nodes[node].get(ts) == winner) {
+      // The ancestors are unaffected:
+      return;
+    }
+    set(ts, node, winner);
+  }
+}
+
+template <bool IsMax>
+void TournamentTree<IsMax>::commitIf(Timestamp ts) {
+  for (const size_t node : _journal.modified(ts)) {
+    _nodes[node].commitIf(ts);
+  }
+}
+
+template class TournamentTree<true>;
+template class TournamentTree<false>;
+
+}  // namespace atlantis::propagation
@@ -62,15 +62,15 @@ void AllDifferent::close(Timestamp ts) {
   if (overlapUb < overlapLb) {
     _counts.clear();
   } else {
-    _counts.resize(static_cast<unsigned long>(overlapUb - overlapLb + 1),
-                   CommittableInt(ts, 0));
+    _counts.resize(ts, static_cast<unsigned long>(overlapUb - overlapLb + 1),
+                   0);
   }
   _offset = overlapLb;
 }
 
 void AllDifferent::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
+  for (size_t i = 0; i < _counts.size(); ++i) {
+    _counts.setValue(ts, i, 0);
   }
 
   Int violInc = 0;
@@ -92,6 +92,23 @@ void AllDifferent::notifyInputChanged(Timestamp ts, LocalId id) {
                             increaseCount(ts, newValue)));
 }
 
+void AllDifferent::notifyInputsChanged(Timestamp ts,
+                                       std::span<const LocalId> localIds) {
+  Int delta = 0;
+  for (const LocalId id : localIds) {
+    assert(id < _vars.size());
+    const Int newValue = _solver.value(ts, _vars[id]);
+    const Int committedValue = _solver.committedValue(_vars[id]);
+    if (newValue != committedValue) {
+      delta += static_cast<Int>(decreaseCount(ts, committedValue) +
+                                increaseCount(ts, newValue));
+    }
+  }
+  if (delta != 0) {
+    incValue(ts, _violationId, delta);
+  }
+}
+
 VarViewId AllDifferent::nextInput(Timestamp ts) {
   const auto index = static_cast<size_t>(_state.incValue(ts, 1));
   if (index < _vars.size()) {
@@ -108,9 +125,7 @@ void AllDifferent::notifyCurrentInputChanged(Timestamp ts) {
 void AllDifferent::commit(Timestamp ts) {
   Invariant::commit(ts);
 
-  for (CommittableInt& committableInt : _counts) {
-    committableInt.commitIf(ts);
-  }
+  _counts.commitIf(ts);
 }
 
 }  // namespace atlantis::propagation
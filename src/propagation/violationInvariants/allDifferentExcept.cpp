@@ -31,8 +31,8 @@ AllDifferentExcept::AllDifferentExcept(SolverBase& solver,
 }
 
 void AllDifferentExcept::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
+  for (size_t i = 0; i < _counts.size(); ++i) {
+    _counts.setValue(ts, i, 0);
   }
 
   Int violInc = 0;
@@ -56,4 +56,22 @@ void AllDifferentExcept::notifyInputChanged(Timestamp ts, LocalId id) {
            (isIgnored(committedValue) ? 0 : decreaseCount(ts, committedValue)) +
                (isIgnored(newValue) ? 0 : increaseCount(ts, newValue)));
 }
+
+void AllDifferentExcept::notifyInputsChanged(
+    Timestamp ts, std::span<const LocalId> localIds) {
+  Int delta = 0;
+  for (const LocalId id : localIds) {
+    assert(id < _vars.size());
+    const Int newValue = _solver.value(ts, _vars[id]);
+    const Int committedValue = _solver.committedValue(_vars[id]);
+    if (newValue != committedValue) {
+      delta +=
+          (isIgnored(committedValue) ? 0 : decreaseCount(ts, committedValue)) +
+          (isIgnored(newValue) ? 0 : increaseCount(ts, newValue));
+    }
+  }
+  if (delta != 0) {
+    incValue(ts, _violationId, delta);
+  }
+}
 }  // namespace atlantis::propagation
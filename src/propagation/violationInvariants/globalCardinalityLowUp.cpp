@@ -80,12 +80,12 @@ void GlobalCardinalityLowUp::updateBounds(bool widenOnly) {
 }
 
 void GlobalCardinalityLowUp::close(Timestamp timestamp) {
-  _counts.resize(_lowerBounds.size(), CommittableInt(timestamp, 0));
+  _counts.resize(timestamp, _lowerBounds.size(), 0);
 }
 
 void GlobalCardinalityLowUp::recompute(Timestamp timestamp) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(timestamp, 0);
+  for (size_t i = 0; i < _counts.size(); ++i) {
+    _counts.setValue(timestamp, i, 0);
   }
 
   for (const auto& var : _vars) {
@@ -101,9 +101,9 @@ void GlobalCardinalityLowUp::recompute(Timestamp timestamp) {
       continue;
     }
     shortage +=
-        std::max(Int(0), _lowerBounds.at(i) - _counts.at(i).value(timestamp));
+        std::max(Int(0), _lowerBounds.at(i) - _counts.value(timestamp, i));
     excess +=
-        std::max(Int(0), _counts.at(i).value(timestamp) - _upperBounds.at(i));
+        std::max(Int(0), _counts.value(timestamp, i) - _upperBounds.at(i));
   }
 
   _shortage.setValue(timestamp, shortage);
@@ -129,6 +129,29 @@ void GlobalCardinalityLowUp::notifyInputChanged(Timestamp timestamp,
                                                        (inc > 0 ? inc : 0))));
 }
 
+void GlobalCardinalityLowUp::notifyInputsChanged(
+    Timestamp timestamp, std::span<const LocalId> localIds) {
+  Int shortageDelta = 0;
+  Int excessDelta = 0;
+  for (const LocalId localId : localIds) {
+    assert(localId < _vars.size());
+    const Int newValue = _solver.value(timestamp, _vars[localId]);
+    const Int committedValue = _solver.committedValue(_vars[localId]);
+    if (newValue == committedValue) {
+      continue;
+    }
+    const signed char dec = decreaseCount(timestamp, committedValue);
+    const signed char inc = increaseCount(timestamp, newValue);
+    shortageDelta += (dec > 0 ? dec : 0) + (inc < 0 ? inc : 0);
+    excessDelta += (dec < 0 ? dec : 0) + (inc > 0 ? inc : 0);
+  }
+  if (shortageDelta != 0 || excessDelta != 0) {
+    updateValue(timestamp, _violationId,
+                std::max(_shortage.incValue(timestamp, shortageDelta),
+                         _excess.incValue(timestamp, excessDelta)));
+  }
+}
+
 VarViewId GlobalCardinalityLowUp::nextInput(Timestamp timestamp) {
   const auto index = static_cast<size_t>(_state.incValue(timestamp, 1));
   assert(0 <= _state.value(timestamp));
@@ -149,8 +172,6 @@ void GlobalCardinalityLowUp::commit(Timestamp timestamp) {
   _shortage.commitIf(timestamp);
   _excess.commitIf(timestamp);
 
-  for (CommittableInt& CommittableInt : _counts) {
-    CommittableInt.commitIf(timestamp);
-  }
+  _counts.commitIf(timestamp);
 }
 }  // namespace atlantis::propagation
@@ -1,5 +1,6 @@
 #include "atlantis/search/annealer.hpp"
 
+#include <cmath>
 #include <limits>
 
 namespace atlantis::search {
@@ -33,6 +34,24 @@ bool Annealer::runMonteCarloSimulation() const {
   return _attemptedMovesPerRound < _requiredMovesPerRound;
 }
 
+Int Annealer::maxAcceptableCost() {
+  const Int assignmentCost = evaluate(_assignment.cost());
+  const auto threshold =
+      static_cast<double>(_random.floatInRange(0.0f, 1.0f));
+  // An uphill move with cost increase delta is accepted iff
+  // exp(-delta / temperature) >= threshold, that is, iff
+  // delta <= -temperature * ln(threshold):
+  if (threshold <= 0.0) {
+    return std::numeric_limits<Int>::max();
+  }
+  const double maxDelta = -_schedule.temperature() * std::log(threshold);
+  if (maxDelta >= static_cast<double>(std::numeric_limits<Int>::max() -
+                                      std::max<Int>(assignmentCost, 0))) {
+    return std::numeric_limits<Int>::max();
+  }
+  return assignmentCost + static_cast<Int>(std::floor(maxDelta));
+}
+
 bool Annealer::accept(Int moveCost) {
   Int assignmentCost = evaluate(_assignment.cost());
   Int delta = moveCost - assignmentCost;
@@ -53,8 +72,7 @@ bool Annealer::accept(Int moveCost) {
   } else {
     _statistics.uphillAttemptedMoves++;
 
-    if (std::exp(static_cast<double>(-delta) / _schedule.temperature()) >=
-        _random.floatInRange(0.0f, 1.0f)) {
+    if (moveCost <= _maxAcceptableCost) {
       _statistics.uphillAcceptedMoves++;
       _statistics.acceptedMoves++;
       return true;
@@ -64,6 +82,13 @@ bool Annealer::accept(Int moveCost) {
   return false;
 }
 
+bool Annealer::reject() {
+  _statistics.attemptedMoves++;
+  _statistics.uphillAttemptedMoves++;
+  _statistics.cutOffMoves++;
+  return false;
+}
+
 void Annealer::start() {
   _schedule.start(INITIAL_TEMPERATURE);
   _violationWeight = 1;
@@ -1,6 +1,7 @@
 #include "atlantis/search/assignment.hpp"
 
 #include <functional>
+#include <limits>
 
 namespace atlantis::search {
 
@@ -20,6 +21,38 @@ Assignment::Assignment(propagation::Solver& solver,
       _searchVars.push_back(varId);
     }
   }
+  if (!solver.isOpen()) {
+    // Enables bounded probes if the violation is a (linear) sum:
+    solver.setProbeCutoffVar(_violation);
+  }
+}
+
+Int Assignment::maxViolation(Int maxCost, UInt violationWeight,
+                             UInt objectiveWeight) const noexcept {
+  if (violationWeight == 0 || maxCost == std::numeric_limits<Int>::max()) {
+    return std::numeric_limits<Int>::max();
+  }
+  Int minObjectiveCost = 0;
+  if (_objective != propagation::NULL_ID && objectiveWeight != 0) {
+    minObjectiveCost =
+        std::min(Cost(0, _solver.lowerBound(_objective), _objectiveDirection)
+                     .evaluate(0, objectiveWeight),
+                 Cost(0, _solver.upperBound(_objective), _objectiveDirection)
+                     .evaluate(0, objectiveWeight));
+  }
+  const Int maxViolationCost = maxCost - minObjectiveCost;
+  if (maxViolationCost < 0) {
+    return -1;
+  }
+  return maxViolationCost / static_cast<Int>(violationWeight);
+}
+
+bool Assignment::commitProbe(propagation::Timestamp probeTimestamp) {
+  if (!_solver.canCommitProbe(probeTimestamp)) {
+    return false;
+  }
+  _solver.commitProbe();
+  return true;
 }
 
 Int Assignment::value(propagation::VarViewId var) const noexcept {
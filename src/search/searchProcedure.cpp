@@ -15,6 +15,8 @@ static void logRoundStatistics(logging::Logger& logger,
   logger.trace("Accepted over attempted uphill moves: {:d} / {:d} = {:.3f}",
                statistics.uphillAcceptedMoves, statistics.uphillAttemptedMoves,
                statistics.uphillAcceptanceRatio());
+  logger.trace("Cut off over attempted uphill moves: {:d} / {:d}",
+               statistics.cutOffMoves, statistics.uphillAttemptedMoves);
   logger.trace("Improving move ratio: {:.3f}", statistics.improvingMoveRatio());
   logger.trace("Lowest cost this round: {:d}", statistics.bestCostOfThisRound);
   logger.trace("Lowest cost previous round: {:d}",
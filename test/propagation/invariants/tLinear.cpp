@@ -178,6 +178,32 @@ TEST_F(LinearTest, NotifyInputChanged) {
   }
 }
 
+TEST_F(LinearTest, NotifyInputsChanged) {
+  _solver->open();
+  for (size_t i = 0; i < numInputs; ++i) {
+    inputs.at(i) = _solver->makeIntVar(inputValueDist(gen), inputLb, inputUb);
+    coeffs.at(i) = coeffDist(gen);
+  }
+  const VarViewId outputId = _solver->makeIntVar(
+      0, std::numeric_limits<Int>::min(), std::numeric_limits<Int>::max());
+  Linear& invariant = _solver->makeInvariant<Linear>(
+      *_solver, outputId, std::vector<Int>(coeffs),
+      std::vector<VarViewId>(inputs));
+  _solver->close();
+
+  const Timestamp ts = _solver->currentTimestamp() + 1;
+
+  std::vector<LocalId> changed;
+  for (size_t i = 0; i < inputs.size(); i += 3) {
+    _solver->setValue(ts, inputs.at(i), inputValueDist(gen));
+    changed.emplace_back(LocalId(i));
+  }
+  const Int expectedOutput = computeOutput(ts, inputs, coeffs);
+
+  invariant.notifyInputsChanged(ts, changed);
+  EXPECT_EQ(expectedOutput, _solver->value(ts, outputId));
+}
+
 TEST_F(LinearTest, NextInput) {
   _solver->open();
   for (size_t i = 0; i < numInputs; ++i) {
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/propagation/bucketPropagationQueue.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class BucketPropagationQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+  }
+  std::mt19937 gen;
+};
+
+/**
+ *  Testing constructor
+ */
+
+TEST_F(BucketPropagationQueueTest, init) {
+  BucketPropagationQueue queue;
+  queue.init(2, 1);
+  queue.initVar(VarId{0}, 1);
+  queue.initVar(VarId{1}, 2);
+  EXPECT_EQ(queue.empty(), true);
+  EXPECT_EQ(queue.pop(), NULL_ID);
+  EXPECT_EQ(queue.top(), NULL_ID);
+}
+
+TEST_F(BucketPropagationQueueTest, isEmpty) {
+  BucketPropagationQueue queue;
+  EXPECT_EQ(queue.empty(), true);
+  queue.init(2, 1);
+  queue.initVar(VarId{0}, 1);
+  queue.initVar(VarId{1}, 2);
+  queue.push(VarId{0});
+  EXPECT_EQ(queue.empty(), false);
+  queue.push(VarId{1});
+  EXPECT_EQ(queue.empty(), false);
+  queue.pop();
+  EXPECT_EQ(queue.empty(), false);
+  queue.pop();
+  EXPECT_EQ(queue.empty(), true);
+}
+
+TEST_F(BucketPropagationQueueTest, pushAndPop) {
+  BucketPropagationQueue queue;
+  queue.init(100, 1);
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.push(varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    EXPECT_EQ(queue.top(), varId);
+    EXPECT_EQ(queue.pop(), varId);
+  }
+}
+
+TEST_F(BucketPropagationQueueTest, pushReverseAndPop) {
+  BucketPropagationQueue queue;
+  queue.init(100, 1);
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  for (VarId varId = 100; varId > 0; --varId) {
+    queue.push(varId - 1);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    EXPECT_EQ(queue.pop(), varId);
+  }
+}
+
+TEST_F(BucketPropagationQueueTest, ignoreDuplicates) {
+  BucketPropagationQueue queue;
+  queue.init(100, 1);
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.push(varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.push(varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    EXPECT_EQ(queue.pop(), varId);
+  }
+  EXPECT_EQ(queue.empty(), true);
+}
+
+TEST_F(BucketPropagationQueueTest, interleavedPushAndPop) {
+  const size_t numVars = 1000;
+  std::vector<size_t> priorities(numVars);
+  std::uniform_int_distribution<size_t> priorityDist(0, numVars / 10);
+  for (size_t& priority : priorities) {
+    priority = priorityDist(gen);
+  }
+  BucketPropagationQueue queue;
+  queue.init(numVars, 1);
+  for (VarId varId = 0; varId < numVars; ++varId) {
+    queue.initVar(varId, priorities[varId]);
+  }
+  std::vector<VarId> order(numVars);
+  for (VarId varId = 0; varId < numVars; ++varId) {
+    order[varId] = varId;
+  }
+  std::shuffle(order.begin(), order.end(), gen);
+
+  // Only push variables with a priority that is not lower than the priority
+  // of the last popped variable, as during propagation:
+  std::vector<bool> popped(numVars, false);
+  size_t lastPriority = 0;
+  size_t numPopped = 0;
+  for (size_t i = 0; i < numVars; ++i) {
+    if (priorities[order[i]] >= lastPriority) {
+      queue.push(order[i]);
+    }
+    if (i % 3 == 0 && !queue.empty()) {
+      const VarId varId = queue.pop();
+      EXPECT_FALSE(popped[varId]);
+      EXPECT_GE(priorities[varId], lastPriority);
+      lastPriority = priorities[varId];
+      popped[varId] = true;
+      ++numPopped;
+    }
+  }
+  while (!queue.empty()) {
+    const VarId varId = queue.pop();
+    EXPECT_FALSE(popped[varId]);
+    EXPECT_GE(priorities[varId], lastPriority);
+    lastPriority = priorities[varId];
+    popped[varId] = true;
+    ++numPopped;
+  }
+  EXPECT_GT(numPopped, 0);
+}
+
+TEST_F(BucketPropagationQueueTest, updatePriority) {
+  BucketPropagationQueue queue;
+  queue.init(10, 1);
+  for (VarId varId = 0; varId < 10; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  for (VarId varId = 0; varId < 10; ++varId) {
+    queue.updatePriority(varId, 9 - varId);
+  }
+  for (VarId varId = 0; varId < 10; ++varId) {
+    queue.push(varId);
+  }
+  for (VarId varId = 10; varId > 0; --varId) {
+    EXPECT_EQ(queue.pop(), varId - 1);
+  }
+  EXPECT_EQ(queue.empty(), true);
+}
+
+}  // namespace atlantis::testing
@@ -1,6 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -735,6 +737,104 @@ TEST_F(SolverTest, TestSimpleDynamicCycleCommit) {
 
   EXPECT_EQ(solver->currentValue(output), 13);
 }
+TEST_F(SolverTest, DynamicCycleRandomMoves) {
+  // x[k] = element(i[k], [base, x[0] + 1, x[1] + 2, ..., x[n - 1] + n]),
+  // where the indices are chosen such that the x[k] are ordered by a
+  // permutation: x[k] either refers to base or to a variable that precedes
+  // it in the permutation.
+  const size_t n = 16;
+  solver->open();
+  const VarViewId base = solver->makeIntVar(0, -10, 10);
+  std::vector<VarViewId> x;
+  std::vector<VarViewId> indices;
+  for (size_t k = 0; k < n; ++k) {
+    x.emplace_back(solver->makeIntVar(0, -1000, 1000));
+    indices.emplace_back(solver->makeIntVar(1, 1, static_cast<Int>(n) + 1));
+  }
+  std::vector<VarViewId> array{base};
+  for (size_t k = 0; k < n; ++k) {
+    array.emplace_back(solver->makeIntView<IntOffsetView>(
+        *solver, x[k], static_cast<Int>(k) + 1));
+  }
+  for (size_t k = 0; k < n; ++k) {
+    solver->makeInvariant<ElementVar>(*solver, x[k], indices[k],
+                                      std::vector<VarViewId>(array));
+  }
+  const VarViewId output = solver->makeIntVar(0, -100000, 100000);
+  solver->makeInvariant<Linear>(*solver, output, std::vector<VarViewId>(x));
+  solver->close();
+
+  std::vector<size_t> permutation(n);
+  std::iota(permutation.begin(), permutation.end(), 0);
+  std::vector<Int> committedIndices(n, 1);
+  Int committedBase = 0;
+
+  const auto expectedValues = [&](const std::vector<Int>& idx, Int baseVal) {
+    std::vector<Int> values(n, 0);
+    for (const size_t k : permutation) {
+      values[k] = idx[k] == 1 ? baseVal
+                              : values[idx[k] - 2] + (idx[k] - 1);
+    }
+    return values;
+  };
+
+  std::uniform_int_distribution<size_t> rankDist(0, n - 1);
+  std::uniform_int_distribution<Int> baseDist(-10, 10);
+  std::uniform_int_distribution<int> actionDist(0, 9);
+
+  for (size_t iteration = 0; iteration < 500; ++iteration) {
+    const int action = actionDist(gen);
+    std::vector<Int> newIndices(committedIndices);
+    Int newBase = committedBase;
+    if (action == 0) {
+      // Change the order of the chain:
+      std::shuffle(permutation.begin(), permutation.end(), gen);
+      for (size_t r = 0; r < n; ++r) {
+        std::uniform_int_distribution<size_t> predDist(0, r);
+        const size_t pred = predDist(gen);
+        newIndices[permutation[r]] =
+            pred == r ? 1 : static_cast<Int>(permutation[pred]) + 2;
+      }
+    } else {
+      // Point a variable to base or to one of its predecessors:
+      const size_t r = rankDist(gen);
+      std::uniform_int_distribution<size_t> predDist(0, r);
+      const size_t pred = predDist(gen);
+      newIndices[permutation[r]] =
+          pred == r ? 1 : static_cast<Int>(permutation[pred]) + 2;
+      if (action == 1) {
+        newBase = baseDist(gen);
+      }
+    }
+    const std::vector<Int> expected = expectedValues(newIndices, newBase);
+
+    solver->beginMove();
+    for (size_t k = 0; k < n; ++k) {
+      solver->setValue(indices[k], newIndices[k]);
+    }
+    solver->setValue(base, newBase);
+    solver->endMove();
+
+    const bool commit = action <= 2;
+    if (commit) {
+      solver->beginCommit();
+      solver->query(output);
+      solver->endCommit();
+      committedIndices = newIndices;
+      committedBase = newBase;
+    } else {
+      solver->beginProbe();
+      solver->query(output);
+      solver->endProbe();
+    }
+    for (size_t k = 0; k < n; ++k) {
+      EXPECT_EQ(solver->currentValue(x[k]), expected[k]);
+    }
+    EXPECT_EQ(solver->currentValue(output),
+              std::accumulate(expected.begin(), expected.end(), Int(0)));
+  }
+}
+
 TEST_F(SolverTest, ComputeBounds) {
   solver->open();
 
@@ -880,10 +980,100 @@ TEST_F(SolverTest, ComputeBoundsCycle) {
   EXPECT_EQ(solver->upperBound(outputs.at(1)), 40);
 }
 
+TEST_F(SolverTest, BoundedProbes) {
+  solver->open();
+
+  // violation = x[0] - 2 * x[1] + 3 * y[0] - y[1] + (z + 1), where
+  //   y[i] = x[i] + x[i + 1] + x[i + 2]
+  //   z = y[0] + y[1] + y[2]
+  // such that the terms of violation are at different positions.
+  const size_t numInputs = 5;
+  std::vector<VarViewId> x;
+  for (size_t i = 0; i < numInputs; ++i) {
+    x.emplace_back(solver->makeIntVar(0, -5, 5));
+  }
+  std::vector<VarViewId> y;
+  for (size_t i = 0; i + 2 < numInputs; ++i) {
+    y.emplace_back(solver->makeIntVar(0, -15, 15));
+    solver->makeInvariant<Linear>(
+        *solver, y.back(), std::vector<VarViewId>{x[i], x[i + 1], x[i + 2]});
+  }
+  const VarViewId z = solver->makeIntVar(0, -45, 45);
+  solver->makeInvariant<Linear>(*solver, z, std::vector<VarViewId>(y));
+  const VarViewId zPlus1 = solver->makeIntView<IntOffsetView>(*solver, z, 1);
+  const VarViewId violation = solver->makeIntVar(0, -1000, 1000);
+  solver->makeInvariant<Linear>(
+      *solver, violation, std::vector<Int>{1, -2, 3, -1, 1},
+      std::vector<VarViewId>{x[0], x[1], y[0], y[1], zPlus1});
+
+  solver->close();
+  EXPECT_TRUE(solver->setProbeCutoffVar(violation));
+  EXPECT_TRUE(solver->canBoundProbes());
+
+  std::uniform_int_distribution<Int> valueDist(-5, 5);
+  std::uniform_int_distribution<size_t> inputDist(0, numInputs - 1);
+  std::uniform_int_distribution<Int> slackDist(-20, 20);
+
+  size_t numCutOff = 0;
+  for (size_t iteration = 0; iteration < 1000; ++iteration) {
+    const VarViewId modified1 = x[inputDist(gen)];
+    const VarViewId modified2 = x[inputDist(gen)];
+    const Int value1 = valueDist(gen);
+    const Int value2 = valueDist(gen);
+
+    solver->beginMove();
+    solver->setValue(modified1, value1);
+    solver->setValue(modified2, value2);
+    solver->endMove();
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+    const Int expected = solver->currentValue(violation);
+
+    const Int maxValue = expected + slackDist(gen);
+    solver->beginMove();
+    solver->setValue(modified1, value1);
+    solver->setValue(modified2, value2);
+    solver->endMove();
+    solver->beginProbe();
+    solver->query(violation);
+    if (solver->endBoundedProbe(maxValue)) {
+      EXPECT_EQ(solver->currentValue(violation), expected);
+      EXPECT_TRUE(solver->canCommitProbe(solver->currentTimestamp()));
+    } else {
+      ++numCutOff;
+      // Only probes that exceed the maximum value are cut off, and the lower
+      // bound is sound:
+      EXPECT_GT(expected, maxValue);
+      EXPECT_GT(solver->probeCutoffLowerBound(), maxValue);
+      EXPECT_LE(solver->probeCutoffLowerBound(), expected);
+      EXPECT_FALSE(solver->canCommitProbe(solver->currentTimestamp()));
+    }
+
+    if (iteration % 3 == 0) {
+      solver->beginMove();
+      solver->setValue(modified1, value1);
+      solver->setValue(modified2, value2);
+      solver->endMove();
+      solver->beginCommit();
+      solver->query(violation);
+      solver->endCommit();
+      EXPECT_EQ(solver->committedValue(violation), expected);
+    }
+  }
+  EXPECT_GT(numCutOff, 0);
+}
+
 TEST_F(SolverTest, InputToOutputPropagation) {
   propagation(PropagationMode::INPUT_TO_OUTPUT, OutputToInputMarkingMode::NONE);
 }
 
+TEST_F(SolverTest, InputToOutputPropagationSortedListQueue) {
+  solver = std::make_shared<Solver>(PropagationQueueType::SORTED_LIST);
+  EXPECT_EQ(solver->propagationQueueType(), PropagationQueueType::SORTED_LIST);
+  propagation(PropagationMode::INPUT_TO_OUTPUT, OutputToInputMarkingMode::NONE);
+}
+
 TEST_F(SolverTest, OutputToInputPropagationNone) {
   propagation(PropagationMode::OUTPUT_TO_INPUT, OutputToInputMarkingMode::NONE);
 }
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/utils/kernels.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class KernelsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+  }
+  std::mt19937 gen;
+
+  std::vector<Int> randomValues(size_t size, Int lb, Int ub) {
+    std::uniform_int_distribution<Int> dist(lb, ub);
+    std::vector<Int> values(size);
+    for (Int& value : values) {
+      value = dist(gen);
+    }
+    return values;
+  }
+};
+
+TEST_F(KernelsTest, DotProduct) {
+  // The sizes cover the remainders of the vectorised loops:
+  for (size_t size = 0; size <= 67; ++size) {
+    const std::vector<Int> coeffs = randomValues(size, -1000, 1000);
+    const std::vector<Int> values = randomValues(size, -1000, 1000);
+    Int expected = 0;
+    for (size_t i = 0; i < size; ++i) {
+      expected += coeffs[i] * values[i];
+    }
+    EXPECT_EQ(kernels::dotProduct(coeffs, values), expected);
+  }
+}
+
+TEST_F(KernelsTest, DotProductOfLargeValues) {
+  // The 64-bit products must be exact, also when the upper 32 bits of the
+  // operands are nonzero:
+  const size_t size = 19;
+  const Int bound = Int{1} << 40;
+  const std::vector<Int> coeffs = randomValues(size, -100000, 100000);
+  const std::vector<Int> values = randomValues(size, -bound, bound);
+  Int expected = 0;
+  for (size_t i = 0; i < size; ++i) {
+    expected += coeffs[i] * values[i];
+  }
+  EXPECT_EQ(kernels::dotProduct(coeffs, values), expected);
+  EXPECT_EQ(kernels::dotProduct(values, coeffs), expected);
+}
+
+TEST_F(KernelsTest, CountEqual) {
+  for (size_t size = 0; size <= 67; ++size) {
+    const std::vector<Int> values = randomValues(size, -2, 2);
+    for (Int needle = -3; needle <= 3; ++needle) {
+      Int expected = 0;
+      for (const Int value : values) {
+        expected += static_cast<Int>(value == needle);
+      }
+      EXPECT_EQ(kernels::countEqual(values, needle), expected);
+    }
+  }
+  const std::vector<Int> extremes{std::numeric_limits<Int>::min(),
+                                  std::numeric_limits<Int>::max(), 0, -1,
+                                  std::numeric_limits<Int>::min()};
+  EXPECT_EQ(kernels::countEqual(extremes, std::numeric_limits<Int>::min()),
+            2);
+}
+
+TEST_F(KernelsTest, SumWhereEqual) {
+  for (size_t size = 0; size <= 67; ++size) {
+    const std::vector<Int> coeffs = randomValues(size, -1000, 1000);
+    const std::vector<Int> values = randomValues(size, 0, 2);
+    for (Int needle = 0; needle <= 2; ++needle) {
+      Int expected = 0;
+      for (size_t i = 0; i < size; ++i) {
+        expected += values[i] == needle ? coeffs[i] : 0;
+      }
+      EXPECT_EQ(kernels::sumWhereEqual(coeffs, values, needle), expected);
+    }
+  }
+}
+
+}  // namespace atlantis::testing
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
 #include <random>
 #include <vector>
@@ -137,4 +138,36 @@ TEST_F(PriorityListTest, CommitIf) {
   }
 }
 
+TEST_F(PriorityListTest, CommitIfSparse) {
+  const size_t size = 100;
+  PriorityList priorityList(size);
+  std::vector<Int> committed(size, 0);
+  std::uniform_int_distribution<size_t> idxDist(0, size - 1);
+  std::uniform_int_distribution<Int> valueDist(-1000, 1000);
+
+  for (Timestamp ts = 1; ts < 1000; ++ts) {
+    // Only some timestamps are committed, and each modifies a few entries,
+    // some of them several times:
+    const bool commit = ts % 3 != 0;
+    std::vector<Int> values(committed);
+    for (size_t i = 0; i < 4; ++i) {
+      const size_t idx = idxDist(gen);
+      values[idx] = valueDist(gen);
+      priorityList.updatePriority(ts, idx, values[idx]);
+    }
+    EXPECT_EQ(priorityList.minPriority(ts),
+              *std::min_element(values.begin(), values.end()));
+    EXPECT_EQ(priorityList.maxPriority(ts),
+              *std::max_element(values.begin(), values.end()));
+    if (commit) {
+      priorityList.commitIf(ts);
+      committed = values;
+    }
+    EXPECT_EQ(priorityList.minPriority(ts + 1),
+              *std::min_element(committed.begin(), committed.end()));
+    EXPECT_EQ(priorityList.maxPriority(ts + 1),
+              *std::max_element(committed.begin(), committed.end()));
+  }
+}
+
 }  // namespace atlantis::testing
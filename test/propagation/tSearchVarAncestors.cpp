@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class SearchVarAncestorsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+  }
+  std::mt19937 gen;
+
+  // Builds the sets from a membership matrix, where isAncestor[v][s] is
+  // true iff search variable s is an ancestor of variable v:
+  static void assign(SearchVarAncestors& ancestors,
+                     const std::vector<std::vector<bool>>& isAncestor,
+                     size_t numSearchVars) {
+    std::vector<size_t> searchVarIndex(isAncestor.size(),
+                                       SearchVarAncestors::NOT_A_SEARCH_VAR);
+    for (size_t s = 0; s < numSearchVars; ++s) {
+      searchVarIndex[s] = s;
+    }
+    std::vector<std::vector<SearchVarAncestors::Block>> rows(
+        isAncestor.size());
+    for (size_t v = 0; v < isAncestor.size(); ++v) {
+      for (size_t s = 0; s < numSearchVars; ++s) {
+        if (!isAncestor[v][s]) {
+          continue;
+        }
+        const size_t blockIndex = s / SearchVarAncestors::BLOCK_SIZE;
+        const uint64_t bit = uint64_t(1) << (s % SearchVarAncestors::BLOCK_SIZE);
+        if (rows[v].empty() || rows[v].back().index != blockIndex) {
+          rows[v].emplace_back(SearchVarAncestors::Block{blockIndex, bit});
+        } else {
+          rows[v].back().bits |= bit;
+        }
+      }
+    }
+    ancestors.assign(std::move(searchVarIndex), rows);
+  }
+};
+
+TEST_F(SearchVarAncestorsTest, NoModifiedSearchVars) {
+  SearchVarAncestors ancestors;
+  const std::vector<std::vector<bool>> isAncestor{
+      {true, false}, {false, true}, {true, true}};
+  assign(ancestors, isAncestor, 2);
+  EXPECT_EQ(ancestors.numVars(), 3);
+  ancestors.setModified({});
+  for (VarId id = 0; id < 3; ++id) {
+    EXPECT_FALSE(ancestors.hasModifiedAncestor(id));
+  }
+}
+
+TEST_F(SearchVarAncestorsTest, SearchVarIndex) {
+  SearchVarAncestors ancestors;
+  assign(ancestors, {{true, false}, {false, true}, {true, true}}, 2);
+  EXPECT_EQ(ancestors.searchVarIndex(0), 0);
+  EXPECT_EQ(ancestors.searchVarIndex(1), 1);
+  EXPECT_EQ(ancestors.searchVarIndex(2), SearchVarAncestors::NOT_A_SEARCH_VAR);
+}
+
+TEST_F(SearchVarAncestorsTest, RandomSets) {
+  for (const size_t numSearchVars : {1, 63, 64, 65, 200, 1000}) {
+    const size_t numVars = numSearchVars + 50;
+    std::bernoulli_distribution density(0.05);
+    std::vector<std::vector<bool>> isAncestor(
+        numVars, std::vector<bool>(numSearchVars, false));
+    for (size_t s = 0; s < numSearchVars; ++s) {
+      isAncestor[s][s] = true;
+    }
+    for (size_t v = numSearchVars; v < numVars; ++v) {
+      for (size_t s = 0; s < numSearchVars; ++s) {
+        isAncestor[v][s] = density(gen);
+      }
+    }
+    SearchVarAncestors ancestors;
+    assign(ancestors, isAncestor, numSearchVars);
+    ASSERT_EQ(ancestors.numVars(), numVars);
+
+    std::uniform_int_distribution<size_t> searchVarDist(0, numSearchVars - 1);
+    for (const size_t numModified : {1, 2, 5, 40}) {
+      std::unordered_set<VarId> modified;
+      for (size_t i = 0; i < numModified; ++i) {
+        modified.emplace(searchVarDist(gen));
+      }
+      ancestors.setModified(modified);
+      for (size_t v = 0; v < numVars; ++v) {
+        bool expected = false;
+        for (const VarId s : modified) {
+          expected = expected || isAncestor[v][s];
+        }
+        EXPECT_EQ(ancestors.hasModifiedAncestor(v), expected);
+      }
+    }
+  }
+}
+
+}  // namespace atlantis::testing
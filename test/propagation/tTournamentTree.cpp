@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/utils/tournamentTree.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class TournamentTreeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+  }
+  std::mt19937 gen;
+
+  // Randomly updates and commits the priorities, and compares the tree
+  // against the expected temporary and committed priorities:
+  template <bool IsMax>
+  void randomUpdates(size_t size) {
+    TournamentTree<IsMax> tree(size);
+    EXPECT_EQ(tree.size(), size);
+    EXPECT_EQ(tree.top(NULL_TIMESTAMP), 0);
+
+    const auto top = [](const std::vector<Int>& values) {
+      return IsMax ? *std::max_element(values.begin(), values.end())
+                   : *std::min_element(values.begin(), values.end());
+    };
+
+    std::vector<Int> committed(size, 0);
+    std::uniform_int_distribution<size_t> idxDist(0, size - 1);
+    std::uniform_int_distribution<Int> valueDist(-100, 100);
+    std::uniform_int_distribution<size_t> numUpdatesDist(1, 2 * size);
+
+    for (Timestamp ts = 1; ts < 200; ++ts) {
+      std::vector<Int> values(committed);
+      const size_t numUpdates = numUpdatesDist(gen);
+      for (size_t i = 0; i < numUpdates; ++i) {
+        const size_t idx = idxDist(gen);
+        values[idx] = valueDist(gen);
+        tree.updatePriority(ts, idx, values[idx]);
+        ASSERT_EQ(tree.top(ts), top(values));
+      }
+      for (size_t idx = 0; idx < size; ++idx) {
+        EXPECT_EQ(tree.priority(ts, idx), values[idx]);
+      }
+      if (ts % 4 != 0) {
+        tree.commitIf(ts);
+        committed = values;
+      }
+      EXPECT_EQ(tree.top(ts + 1), top(committed));
+    }
+  }
+};
+
+TEST_F(TournamentTreeTest, MaxRandomUpdates) {
+  for (const size_t size : {1, 2, 3, 7, 8, 9, 100}) {
+    randomUpdates<true>(size);
+  }
+}
+
+TEST_F(TournamentTreeTest, MinRandomUpdates) {
+  for (const size_t size : {1, 2, 3, 7, 8, 9, 100}) {
+    randomUpdates<false>(size);
+  }
+}
+
+}  // namespace atlantis::testing
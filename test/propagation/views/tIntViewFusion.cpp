@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/equalConst.hpp"
+#include "atlantis/propagation/views/greaterEqualConst.hpp"
+#include "atlantis/propagation/views/intAbsView.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+#include "atlantis/propagation/views/lessEqualConst.hpp"
+#include "atlantis/propagation/views/modView.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/views/scalarView.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class IntViewFusionTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<Solver> _solver;
+  std::mt19937 gen;
+
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+    _solver = std::make_unique<Solver>();
+  }
+
+  // Checks that the values and bounds of each view are the expected function
+  // of the variable for each value in its domain:
+  template <class F>
+  void expectValues(VarViewId varId, const std::vector<VarViewId>& viewIds,
+                    const std::vector<F>& expected) {
+    const Int lb = _solver->lowerBound(varId);
+    const Int ub = _solver->upperBound(varId);
+    for (size_t i = 0; i < viewIds.size(); ++i) {
+      Int expectedLb = expected[i](lb);
+      Int expectedUb = expected[i](lb);
+      for (Int val = lb; val <= ub; ++val) {
+        expectedLb = std::min(expectedLb, expected[i](val));
+        expectedUb = std::max(expectedUb, expected[i](val));
+      }
+      EXPECT_LE(_solver->lowerBound(viewIds[i]), expectedLb);
+      EXPECT_GE(_solver->upperBound(viewIds[i]), expectedUb);
+    }
+    for (Int val = lb; val <= ub; ++val) {
+      _solver->beginMove();
+      _solver->setValue(varId, val);
+      _solver->endMove();
+      for (size_t i = 0; i < viewIds.size(); ++i) {
+        EXPECT_EQ(_solver->currentValue(viewIds[i]), expected[i](val));
+      }
+    }
+  }
+};
+
+TEST_F(IntViewFusionTest, DeduplicatesViews) {
+  _solver->open();
+  const VarViewId x = _solver->makeIntVar(0, -5, 5);
+  const VarViewId y = _solver->makeIntVar(0, -5, 5);
+  const VarViewId v1 = _solver->makeIntView<ModView>(*_solver, x, 3);
+  EXPECT_EQ(_solver->makeIntView<ModView>(*_solver, x, 3), v1);
+  EXPECT_NE(_solver->makeIntView<ModView>(*_solver, x, 4), v1);
+  EXPECT_NE(_solver->makeIntView<ModView>(*_solver, y, 3), v1);
+  const VarViewId v2 = _solver->makeIntView<ScalarView>(*_solver, x, 2, 1);
+  EXPECT_EQ(_solver->makeIntView<ScalarView>(*_solver, x, 2, 1), v2);
+  EXPECT_NE(_solver->makeIntView<ScalarView>(*_solver, x, 1, 2), v2);
+  EXPECT_NE(_solver->makeIntView<EqualConst>(*_solver, x, 1),
+            _solver->makeIntView<NotEqualConst>(*_solver, x, 1));
+  _solver->close();
+}
+
+TEST_F(IntViewFusionTest, FusesAffineViews) {
+  std::uniform_int_distribution<Int> constDist(-4, 4);
+  for (size_t iteration = 0; iteration < 20; ++iteration) {
+    _solver->open();
+    const VarViewId x = _solver->makeIntVar(0, -6, 6);
+    const Int a = constDist(gen);
+    const Int b = constDist(gen);
+    const Int c = constDist(gen);
+    const Int d = constDist(gen);
+
+    const VarViewId offset =
+        _solver->makeIntView<IntOffsetView>(*_solver, x, b);
+    const VarViewId scalar =
+        _solver->makeIntView<ScalarView>(*_solver, offset, a, c);
+    const VarViewId offsetOfScalar =
+        _solver->makeIntView<IntOffsetView>(*_solver, scalar, d);
+    const VarViewId scalarOfScalar =
+        _solver->makeIntView<ScalarView>(*_solver, scalar, d, b);
+    const VarViewId absOfNegation = _solver->makeIntView<IntAbsView>(
+        *_solver, _solver->makeIntView<ScalarView>(*_solver, x, -1));
+    _solver->close();
+
+    // All fused views are views of x:
+    for (const VarViewId& viewId :
+         {scalar, offsetOfScalar, scalarOfScalar, absOfNegation}) {
+      EXPECT_EQ(_solver->store().constIntView(ViewId(viewId)).parentId(), x);
+    }
+    using Function = std::function<Int(Int)>;
+    expectValues<Function>(
+        x, {offset, scalar, offsetOfScalar, scalarOfScalar, absOfNegation},
+        {[&](Int v) { return v + b; }, [&](Int v) { return a * (v + b) + c; },
+         [&](Int v) { return a * (v + b) + c + d; },
+         [&](Int v) { return d * (a * (v + b) + c) + b; },
+         [&](Int v) { return std::abs(v); }});
+  }
+}
+
+TEST_F(IntViewFusionTest, FusesComparisonsOfAffineViews) {
+  std::uniform_int_distribution<Int> constDist(-4, 4);
+  std::uniform_int_distribution<Int> factorDist(-3, 3);
+  for (size_t iteration = 0; iteration < 20; ++iteration) {
+    _solver->open();
+    const VarViewId x = _solver->makeIntVar(0, -6, 6);
+    const Int a = factorDist(gen);
+    const Int b = constDist(gen);
+    const Int c = constDist(gen);
+    const VarViewId affine =
+        _solver->makeIntView<ScalarView>(*_solver, x, a, b);
+    const std::vector<VarViewId> viewIds{
+        _solver->makeIntView<EqualConst>(*_solver, affine, c),
+        _solver->makeIntView<NotEqualConst>(*_solver, affine, c),
+        _solver->makeIntView<LessEqualConst>(*_solver, affine, c),
+        _solver->makeIntView<GreaterEqualConst>(*_solver, affine, c)};
+    _solver->close();
+
+    using Function = std::function<Int(Int)>;
+    expectValues<Function>(
+        x, viewIds,
+        {[&](Int v) { return std::abs(a * v + b - c); },
+         [&](Int v) { return static_cast<Int>(a * v + b == c); },
+         [&](Int v) { return std::max<Int>(0, a * v + b - c); },
+         [&](Int v) { return std::max<Int>(0, c - a * v - b); }});
+  }
+}
+
+}  // namespace atlantis::testing
@@ -128,6 +128,37 @@ TEST_F(AllDifferentTest, NotifyInputChanged) {
   }
 }
 
+TEST_F(AllDifferentTest, NotifyInputsChanged) {
+  const Int lb = -2;
+  const Int ub = 2;
+  _solver->open();
+  std::vector<VarViewId> inputs;
+  for (size_t i = 0; i < 5; ++i) {
+    inputs.emplace_back(_solver->makeIntVar(lb, lb, ub));
+  }
+  const VarViewId violationId = _solver->makeIntVar(0, 0, 4);
+  AllDifferent& invariant = _solver->makeViolationInvariant<AllDifferent>(
+      *_solver, violationId, std::vector<VarViewId>(inputs));
+  _solver->close();
+
+  std::uniform_int_distribution<Int> valueDist(lb, ub);
+  for (Timestamp ts = _solver->currentTimestamp() + 1;
+       ts < _solver->currentTimestamp() + 100; ++ts) {
+    std::vector<LocalId> changed;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      const Int newValue = valueDist(gen);
+      if (newValue != _solver->committedValue(inputs[i])) {
+        _solver->setValue(ts, inputs[i], newValue);
+        changed.emplace_back(LocalId(i));
+      }
+    }
+    const Int expectedViolation = computeViolation(ts, inputs);
+
+    invariant.notifyInputsChanged(ts, changed);
+    EXPECT_EQ(expectedViolation, _solver->value(ts, violationId));
+  }
+}
+
 TEST_F(AllDifferentTest, NextInput) {
   const size_t numInputs = 1000;
   const Int lb = 0;
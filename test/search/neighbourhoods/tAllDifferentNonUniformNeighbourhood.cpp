@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <unordered_set>
 
 #include "atlantis/search/annealing/annealerContainer.hpp"
@@ -17,6 +18,9 @@ class AlwaysAcceptingAnnealer : public search::Annealer {
       : Annealer(assignment, random, schedule) {}
 
  protected:
+  [[nodiscard]] Int maxAcceptableCost() override {
+    return std::numeric_limits<Int>::max();
+  }
   [[nodiscard]] bool accept(Int) override { return true; }
 };
 
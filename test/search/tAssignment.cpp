@@ -4,6 +4,7 @@
 #include "atlantis/propagation/solver.hpp"
 #include "atlantis/propagation/violationInvariants/equal.hpp"
 #include "atlantis/search/assignment.hpp"
+#include "atlantis/search/move.hpp"
 
 namespace atlantis::testing {
 
@@ -100,6 +101,168 @@ TEST_F(AssignmentTest, probe) {
   EXPECT_EQ(cost.evaluate(1, 1), 1);
 }
 
+TEST_F(AssignmentTest, commit_probe) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  auto cost = assignment.probe([&](auto& modifications) {
+    modifications.set(a, 1);
+    modifications.set(b, 2);
+  });
+  const propagation::Timestamp probeTimestamp = assignment.currentTimestamp();
+
+  EXPECT_TRUE(assignment.commitProbe(probeTimestamp));
+
+  EXPECT_EQ(assignment.value(a), 1);
+  EXPECT_EQ(assignment.value(b), 2);
+  EXPECT_EQ(solver.committedValue(c), 3);
+  EXPECT_TRUE(assignment.satisfiesConstraints());
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), cost.evaluate(1, 1));
+
+  // A probe can only be committed once:
+  EXPECT_FALSE(assignment.commitProbe(probeTimestamp));
+}
+
+TEST_F(AssignmentTest, commit_probe_after_another_probe) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  [[maybe_unused]] auto cost1 = assignment.probe([&](auto& modifications) {
+    modifications.set(a, 1);
+    modifications.set(b, 2);
+  });
+  const propagation::Timestamp probeTimestamp = assignment.currentTimestamp();
+
+  [[maybe_unused]] auto cost2 = assignment.probe([&](auto& modifications) {
+    modifications.set(a, 5);
+    modifications.set(b, 5);
+  });
+
+  EXPECT_FALSE(assignment.commitProbe(probeTimestamp));
+
+  EXPECT_EQ(assignment.value(a), 0);
+  EXPECT_EQ(assignment.value(b), 0);
+  EXPECT_EQ(solver.committedValue(c), 0);
+}
+
+TEST_F(AssignmentTest, move_commit) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  Move<2> move1({a, b}, {1, 2});
+  Move<2> move2({a, b}, {4, 6});
+
+  EXPECT_EQ(move1.probe(assignment).evaluate(1, 1), 1);
+  EXPECT_EQ(move2.probe(assignment).evaluate(1, 1), 11);
+
+  // move1 is no longer the most recently probed move, and is therefore
+  // propagated again:
+  move1.commit(assignment);
+  EXPECT_EQ(assignment.value(a), 1);
+  EXPECT_EQ(assignment.value(b), 2);
+  EXPECT_EQ(solver.committedValue(c), 3);
+
+  // move3 is committed in place:
+  Move<2> move3({a, b}, {0, 3});
+  EXPECT_EQ(move3.probe(assignment).evaluate(1, 1), 0);
+  move3.commit(assignment);
+  EXPECT_EQ(assignment.value(a), 0);
+  EXPECT_EQ(assignment.value(b), 3);
+  EXPECT_EQ(solver.committedValue(c), 3);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), 0);
+}
+
+TEST_F(AssignmentTest, probe_batch) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  std::vector<Move<2>> moves;
+  std::vector<Int> expectedCosts;
+  for (Int aVal = 0; aVal <= 3; ++aVal) {
+    for (Int bVal = 0; bVal <= 3; ++bVal) {
+      moves.emplace_back(std::array<propagation::VarViewId, 2>{a, b},
+                         std::array<Int, 2>{aVal, bVal});
+      Move<2> single({a, b}, {aVal, bVal});
+      expectedCosts.emplace_back(single.probe(assignment).evaluate(1, 1));
+    }
+  }
+  // Already probed moves are not probed again:
+  EXPECT_EQ(moves.front().probe(assignment).evaluate(1, 1),
+            expectedCosts.front());
+
+  const std::vector<Cost> costs =
+      assignment.probe(std::span<Move<2>>(moves));
+
+  EXPECT_EQ(costs.size(), moves.size());
+  for (size_t i = 0; i < costs.size(); ++i) {
+    EXPECT_EQ(costs[i].evaluate(1, 1), expectedCosts[i]);
+    EXPECT_EQ(moves[i].probe(assignment).evaluate(1, 1), expectedCosts[i]);
+  }
+
+  // The probes did not change the assignment:
+  EXPECT_EQ(assignment.value(a), 0);
+  EXPECT_EQ(assignment.value(b), 0);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), 3);
+
+  // The last move of the batch is committed in place:
+  moves.back().commit(assignment);
+  EXPECT_EQ(assignment.value(a), 3);
+  EXPECT_EQ(assignment.value(b), 3);
+  EXPECT_EQ(solver.committedValue(c), 6);
+
+  // Any other move is propagated again:
+  moves[5].commit(assignment);
+  EXPECT_EQ(assignment.value(a), 1);
+  EXPECT_EQ(assignment.value(b), 1);
+  EXPECT_EQ(solver.committedValue(c), 2);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), expectedCosts[5]);
+}
+
+TEST_F(AssignmentTest, probe_batch_output_to_input) {
+  for (const auto markingMode :
+       {propagation::OutputToInputMarkingMode::NONE,
+        propagation::OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC,
+        propagation::OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION}) {
+    solver.open();
+    solver.setPropagationMode(propagation::PropagationMode::OUTPUT_TO_INPUT);
+    solver.setOutputToInputMarkingMode(markingMode);
+    solver.close();
+
+    search::Assignment assignment{solver, violation, a,
+                                  propagation::ObjectiveDirection::MINIMIZE,
+                                  solver.lowerBound(a)};
+
+    // Alternate between candidates that modify a and candidates that
+    // modify b:
+    std::vector<Move<1>> moves;
+    std::vector<Int> expectedCosts;
+    for (Int val = 0; val <= 5; ++val) {
+      const propagation::VarViewId var = val % 2 == 0 ? a : b;
+      moves.emplace_back(std::array<propagation::VarViewId, 1>{var},
+                         std::array<Int, 1>{val});
+      Move<1> single({var}, {val});
+      expectedCosts.emplace_back(single.probe(assignment).evaluate(1, 1));
+    }
+
+    const std::vector<Cost> costs =
+        assignment.probe(std::span<Move<1>>(moves));
+
+    EXPECT_EQ(costs.size(), moves.size());
+    for (size_t i = 0; i < costs.size(); ++i) {
+      EXPECT_EQ(costs[i].evaluate(1, 1), expectedCosts[i]);
+    }
+
+    // The probes did not change the assignment:
+    EXPECT_EQ(assignment.value(a), 0);
+    EXPECT_EQ(assignment.value(b), 0);
+    EXPECT_EQ(assignment.cost().evaluate(1, 1), 3);
+  }
+}
+
 TEST_F(AssignmentTest, satisfies_constraints) {
   search::Assignment assignment{solver, violation, a,
                                 propagation::ObjectiveDirection::MINIMIZE,
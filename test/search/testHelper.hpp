@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include "atlantis/search/annealer.hpp"
 
 namespace atlantis::testing {
@@ -12,6 +14,9 @@ class AlwaysAcceptingAnnealer : public search::Annealer {
       : Annealer(assignment, random, schedule) {}
 
  protected:
+  [[nodiscard]] Int maxAcceptableCost() override {
+    return std::numeric_limits<Int>::max();
+  }
   [[nodiscard]] bool accept(Int) override { return true; }
 };
 